@@ -78,14 +78,18 @@ void BackgroundScroller::update()
 	float pixelDisplacement = floorSpeed * Time::deltaTime() * 0.001f * m_backgroundSpeedModifier;
 	if (pixelDisplacement)
 	{
+		bool wasPositive = m_position.x >= 0;
+		bool hasWrapped = false;
 		m_position.x += pixelDisplacement;
 		if (m_position.x > m_spriteWidth)
 		{
 			m_position.x -= m_spriteWidth;
+			hasWrapped = true;
 		}
 		else if (m_position.x < -m_spriteWidth)
 		{
 			m_position.x += m_spriteWidth;
+			hasWrapped = true;
 		}
 
 		if (m_position.x >= 0)
@@ -96,6 +100,19 @@ void BackgroundScroller::update()
 		{
 			m_bg2->transform->setLocalPosition(Vector2((float)m_spriteWidth, 0));
 		}
+
+		if (hasWrapped || wasPositive != (m_position.x >= 0))
+		{
+			snapBackgrounds();
+		}
 	}
 	gameObject()->transform->setLocalPosition(m_position);
 }
+
+
+void BackgroundScroller::snapBackgrounds()
+{
+	// Both move with the wrap, while the second one also jumps to the other side when the position changes sign
+	m_bg1->getComponent<Sprite>()->snapToTransform();
+	m_bg2->getComponent<Sprite>()->snapToTransform();
+}
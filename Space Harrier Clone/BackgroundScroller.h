@@ -17,6 +17,9 @@ public:
 	virtual void update() override;
 
 private:
+	// The backgrounds wrap around by teleporting, which must not be interpolated
+	void snapBackgrounds();
+
 	Reference<FloorManager> m_floorManager;
 	int m_spriteWidth = 0;
 	Reference<GameObject> m_bg1;
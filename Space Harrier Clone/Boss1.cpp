@@ -7,6 +7,7 @@
 #include "Engine/API.h"
 #include "Engine/Collider.h"
 #include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "gameData.h"
 #include "utils.h"
 #include "FloorManager.h"
@@ -92,8 +93,8 @@ void Boss1::awake()
 	m_sfxBossShot = Audio::loadSFX(ASSET_SFX_BOSS_SHOT);
 	m_collider = gameObject()->getComponentInChildren<Collider>();
 	m_headSprite = m_collider->gameObject()->getComponent<Sprite>();
-	m_shadowSprite = gameObject()->getComponent<Sprite>();
-	assert(m_sfxBossShot && m_collider && m_headSprite && m_shadowSprite);
+	m_shadow = gameObject()->getComponent<ShadowRenderer>();
+	assert(m_sfxBossShot && m_collider && m_headSprite && m_shadow);
 
 	m_shotsPool = new GameObjectPool(Prefabs::getPrefab("Boss1ShotPrefab"), 6);
 
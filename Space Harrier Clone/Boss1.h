@@ -10,6 +10,7 @@
 class Transform;
 class Collider;
 class Sprite;
+class ShadowRenderer;
 class FloorManager;
 class GameObjectPool;
 class Boss1ChainLink;
@@ -46,7 +47,7 @@ private:
 	SFX m_sfxBossShot;
 	GameObjectPool* m_shotsPool = nullptr;
 	Reference<Collider> m_collider;
-	Reference<Sprite> m_shadowSprite;
+	Reference<ShadowRenderer> m_shadow;
 	Reference<Sprite> m_headSprite;
 	int m_currentSpritesSet;
 
@@ -5,6 +5,7 @@
 #include "Engine/Transform.h"
 #include "Engine/Collider.h"
 #include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/API.h"
 #include "Engine/gameConfig.h"
 #include "gameData.h"
@@ -36,8 +37,8 @@ void Boss1ChainLink::awake()
 {
 	m_collider = gameObject()->getComponentInChildren<Collider>();
 	m_chainLinkSprite = m_collider->gameObject()->getComponent<Sprite>();
-	m_shadowSprite = gameObject()->getComponent<Sprite>();
-	assert(m_collider && m_chainLinkSprite && m_shadowSprite);
+	m_shadow = gameObject()->getComponent<ShadowRenderer>();
+	assert(m_collider && m_chainLinkSprite && m_shadow);
 
 	m_scale.x = m_scale.y = 0;
 	gameObject()->transform->setLocalScale(m_scale);
@@ -10,6 +10,7 @@
 class Transform;
 class Collider;
 class Sprite;
+class ShadowRenderer;
 class FloorManager;
 
 
@@ -40,7 +41,7 @@ private:
 	bool m_playerDead;
 
 	Reference<Collider> m_collider;
-	Reference<Sprite> m_shadowSprite;
+	Reference<ShadowRenderer> m_shadow;
 	Reference<Sprite> m_chainLinkSprite;
 	
 	Reference<Boss1ChainLink> m_nextLink;
@@ -4,6 +4,7 @@
 #include "Engine/Transform.h"
 #include "Engine/gameConfig.h"
 #include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/RectangleCollider.h"
 #include "gameData.h"
 #include "Boss1ChainLink.h"
@@ -48,7 +49,7 @@ void Boss1ChainLinkPrefab::configureGameObject(Reference<GameObject>& gameObject
 		}
 	}
 
-	auto shadow = gameObject->addComponent<Sprite>();
+	auto shadow = gameObject->addComponent<ShadowRenderer>();
 	if (shadow)
 	{
 		shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
@@ -56,7 +57,6 @@ void Boss1ChainLinkPrefab::configureGameObject(Reference<GameObject>& gameObject
 
 		shadow->loadImage(ASSET_IMG_BOSS);
 		shadow->setClipRect(SDL_Rect{ 340, 480, 62, 18 });
-		shadow->setAllPivots(Vector2(0.5f, 0));
 
 	}
 
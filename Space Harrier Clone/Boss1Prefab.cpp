@@ -4,6 +4,7 @@
 #include "Engine/Transform.h"
 #include "Engine/gameConfig.h"
 #include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/RectangleCollider.h"
 #include "gameData.h"
 #include "Boss1.h"
@@ -45,7 +46,7 @@ void Boss1Prefab::configureGameObject(Reference<GameObject>& gameObject) const
 		}
 	}
 
-	auto shadow = gameObject->addComponent<Sprite>();
+	auto shadow = gameObject->addComponent<ShadowRenderer>();
 	if (shadow)
 	{
 		shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
@@ -53,7 +54,6 @@ void Boss1Prefab::configureGameObject(Reference<GameObject>& gameObject) const
 
 		shadow->loadImage(ASSET_IMG_BOSS);
 		shadow->setClipRect(SDL_Rect{ 340, 480, 62, 18 });
-		shadow->setAllPivots(Vector2(0.5f, 0));
 	}
 
 	gameObject->setActive(false);
@@ -68,11 +68,11 @@ void EnemiesFactory::init(const Reference<Transform>& playerTransform, const Ref
 		{
 			assert(spawnInfo.motionPatternIndex >= 0 && spawnInfo.motionPatternIndex < (int)m_motionPatterns.size());
 
-			if (m_spawnSfxs.count(spawnInfo.spawnSfxName) == 0)
+			if (m_spawnSfxs.count(spawnInfo.spawnSfxName.id()) == 0)
 			{
 				SFX sfx = Audio::loadSFX(spawnInfo.spawnSfxName);
 				assert(sfx);
-				m_spawnSfxs[spawnInfo.spawnSfxName] = sfx;
+				m_spawnSfxs[spawnInfo.spawnSfxName.id()] = sfx;
 			}
 		}
 	}
@@ -140,7 +140,7 @@ void EnemiesFactory::spawnEnemy()
 		{
 			explosiveObject->init(m_explosionsPool, m_sfxExplosion);
 		}
-		Audio::playSFX(m_spawnSfxs[spawnInfo.spawnSfxName]);
+		Audio::playSFX(m_spawnSfxs[spawnInfo.spawnSfxName.id()]);
 	}
 	else
 	{
@@ -3,9 +3,11 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include "Engine/Behaviour.h"
 #include "Engine/Reference.h"
 #include "Engine/SFX.h"
+#include "Engine/AssetId.h"
 class Transform;
 class MotionPattern;
 class GameObjectPool;
@@ -36,7 +38,7 @@ private:
 	std::vector<MotionPattern> m_motionPatterns;
 
 	std::map<std::string, GameObjectPool*> m_prefabPools;
-	std::map<std::string, SFX> m_spawnSfxs;
+	std::unordered_map<AssetId, SFX, AssetId::Hasher> m_spawnSfxs;
 
 	GameObjectPool* m_explosionsPool = nullptr;
 	GameObjectPool* m_enemyShotsPool = nullptr;
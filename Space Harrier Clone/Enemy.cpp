@@ -3,6 +3,7 @@
 #include <assert.h>
 #include "Engine/GameObject.h"
 #include "Engine/SpriteSheet.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/API.h"
 #include "Engine/Collider.h"
 #include "Engine/Transform.h"
@@ -35,9 +36,9 @@ void Enemy::init(int lifeTimeMS, const MotionPattern& motionPattern, const Refer
 	{
 		m_characterGo = gameObject()->getComponentInChildren<Collider>()->gameObject();
 	}
-	if (!m_shadowGo)
+	if (!m_shadow)
 	{
-		m_shadowGo = gameObject()->getComponentInChildren<Sprite>()->gameObject();
+		m_shadow = gameObject()->getComponent<ShadowRenderer>();
 	}
 	if (!m_poolHandler)
 	{
@@ -45,7 +46,7 @@ void Enemy::init(int lifeTimeMS, const MotionPattern& motionPattern, const Refer
 	}
 	m_lifeTimeMS = lifeTimeMS;
 
-	assert(m_motionPattern.isValid() && m_floorManager && m_playerTransform && m_enemyShotPool && m_sfxEnemyShot && m_spriteSheet && m_characterGo && m_shadowGo && m_poolHandler && m_lifeTimeMS > 0);
+	assert(m_motionPattern.isValid() && m_floorManager && m_playerTransform && m_enemyShotPool && m_sfxEnemyShot && m_spriteSheet && m_characterGo && m_shadow && m_poolHandler && m_lifeTimeMS > 0);
 
 	m_elapsedTime = 0;
 	if (m_collider)
@@ -95,7 +96,7 @@ void Enemy::update()
 	// Increase the scale by 0.1f to better reflect the behaviour form the original game
 	float scale = (1 - mpp.normalizedDepth) + 0.1f;
 	m_characterGo->transform->setLocalScale(Vector2(scale, scale));
-	m_shadowGo->transform->setLocalScale(Vector2(scale, scale));
+	m_shadow->setScale(Vector2(scale, scale));
 
 	// Update z-indexes
 	int zIndex = (int)((1 - mpp.normalizedDepth) * 100);
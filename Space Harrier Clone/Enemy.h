@@ -8,6 +8,7 @@
 class Transform;
 class Collider;
 class SpriteSheet;
+class ShadowRenderer;
 class GameObject;
 class FloorManager;
 class PooledGameObject;
@@ -34,7 +35,7 @@ protected:
 	Reference<Transform> m_playerTransform;
 	Reference<SpriteSheet> m_spriteSheet;
 	Reference<GameObject> m_characterGo;
-	Reference<GameObject> m_shadowGo;
+	Reference<ShadowRenderer> m_shadow;
 	Reference<PooledGameObject> m_poolHandler;
 	GameObjectPool* m_enemyShotPool = nullptr;
 	SFX m_sfxEnemyShot;
@@ -2,7 +2,7 @@
 
 #include "Engine/GameObject.h"
 #include "Engine/Transform.h"
-#include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/SpriteSheet.h"
 #include "Engine/CircleCollider.h"
 #include "gameData.h"
@@ -55,20 +55,13 @@ void EnemyShotPrefab::configureGameObject(Reference<GameObject>& gameObject) con
 		}
 	}
 
-	auto shadowGo = GameObject::createNew();
-	if (shadowGo)
+	auto shadow = gameObject->addComponent<ShadowRenderer>();
+	if (shadow)
 	{
-		shadowGo->transform->setParent(gameObject->transform, false);
+		shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
+		shadow->setZIndex(0);
 
-		auto shadow = shadowGo->addComponent<Sprite>();
-		if (shadow)
-		{
-			shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
-			shadow->setZIndex(0);
-
-			shadow->loadImage(ASSET_IMG_ENEMIES);
-			shadow->setClipRect(SDL_Rect{ 235, 150, 62, 18 });
-			shadow->setAllPivots(Vector2(0.5f, 0));
-		}
+		shadow->loadImage(ASSET_IMG_ENEMIES);
+		shadow->setClipRect(SDL_Rect{ 235, 150, 62, 18 });
 	}
 }
@@ -2,18 +2,19 @@
 #define H_ENEMY_SPAWN_INFO
 
 #include <string>
+#include "Engine/AssetId.h"
 
 
 struct EnemySpawnInfo
 {
 public:
-	EnemySpawnInfo(const std::string& aPrefabName, int aSpawnTime, int aMotionPatternIndex, const std::string& aSpawnSfxName)
+	EnemySpawnInfo(const std::string& aPrefabName, int aSpawnTime, int aMotionPatternIndex, const AssetPath& aSpawnSfxName)
 		: prefabName(aPrefabName), spawnTime(aSpawnTime), motionPatternIndex(aMotionPatternIndex), spawnSfxName(aSpawnSfxName) {}
 
 	std::string prefabName;
 	int spawnTime;
 	int motionPatternIndex;
-	std::string spawnSfxName;
+	AssetPath spawnSfxName;
 };
 
 
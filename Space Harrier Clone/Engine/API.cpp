@@ -8,6 +8,7 @@
 #include "PrefabsFactory.h"
 #include "Music.h"
 #include "SFX.h"
+#include "JobSystem.h"
 
 
 void Scenes::loadScene(unsigned int index)
@@ -16,6 +17,24 @@ void Scenes::loadScene(unsigned int index)
 }
 
 
+void Scenes::preloadScene(unsigned int index)
+{
+	engine->sceneManager->preloadScene(index);
+}
+
+
+bool Scenes::isLoadingScene()
+{
+	return engine->sceneManager->isLoadingScene();
+}
+
+
+float Scenes::getLoadProgress()
+{
+	return engine->sceneManager->getLoadProgress();
+}
+
+
 bool Input::getKey(SDL_Scancode scancode)
 {
 	return engine->input->getKey(scancode);
@@ -46,12 +65,24 @@ Uint32 Time::deltaTime()
 }
 
 
+float Time::interpolationFactor()
+{
+	return engine->time->interpolationFactor();
+}
+
+
 Music Audio::loadMusic(const std::string& path)
 {
 	return engine->audio->loadMusic(path);
 }
 
 
+Music Audio::loadMusic(const AssetPath& asset)
+{
+	return engine->audio->loadMusic(asset);
+}
+
+
 bool Audio::unloadMusic(Music& music)
 {
 	return engine->audio->unloadMusic(music);
@@ -70,6 +101,12 @@ SFX Audio::loadSFX(const std::string& path)
 }
 
 
+SFX Audio::loadSFX(const AssetPath& asset)
+{
+	return engine->audio->loadSFX(asset);
+}
+
+
 bool Audio::unloadSFX(SFX& sfx)
 {
 	return engine->audio->unloadSFX(sfx);
@@ -148,6 +185,12 @@ void Audio::setSFXVolume(float normalizedVolume)
 }
 
 
+void Jobs::defer(const std::function<void()>& command)
+{
+	engine->jobSystem->defer(command);
+}
+
+
 Reference<Prefab> Prefabs::getPrefab(const std::string& id)
 {
 	return engine->prefabsFactory->getPrefab(id);
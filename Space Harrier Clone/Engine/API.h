@@ -2,8 +2,10 @@
 #define H_API
 
 #include <string>
+#include <functional>
 #include "SDL2/include/SDL_scancode.h"
 #include "Reference.h"
+#include "AssetId.h"
 class Prefab;
 class GameObject;
 struct Music;
@@ -13,6 +15,9 @@ struct SFX;
 namespace Scenes
 {
 	void loadScene(unsigned int index);
+	void preloadScene(unsigned int index);
+	bool isLoadingScene();
+	float getLoadProgress();
 }
 
 
@@ -28,15 +33,18 @@ namespace Time
 {
 	Uint32 time();
 	Uint32 deltaTime();
+	float interpolationFactor();
 }
 
 
 namespace Audio
 {
 	Music loadMusic(const std::string& path);
+	Music loadMusic(const AssetPath& asset);
 	bool unloadMusic(Music& music);
 	void unloadAllMusic();
 	SFX loadSFX(const std::string& path);
+	SFX loadSFX(const AssetPath& asset);
 	bool unloadSFX(SFX& sfx);
 	void unloadAllSFX();
 	void playMusic(const Music& music, int repetitions = -1);
@@ -53,6 +61,13 @@ namespace Audio
 }
 
 
+namespace Jobs
+{
+	// From a parallel-safe update: queues command to run once the parallel update is done (runs it right away otherwise)
+	void defer(const std::function<void()>& command);
+}
+
+
 namespace Prefabs
 {
 	Reference<Prefab> getPrefab(const std::string& id);
@@ -0,0 +1,66 @@
+#ifndef H_ASSET_ID
+#define H_ASSET_ID
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+
+// Identifies an asset by the (32 bits FNV-1a) hash of its path
+// Built from a string literal (as AssetPath does), the hash is computed at compile time
+// A path only known at runtime (std::string) hashes to the same id
+class AssetId final
+{
+public:
+	constexpr AssetId() : m_hash(0) {}
+	template<size_t N>
+	constexpr AssetId(const char(&path)[N]) : m_hash(hash(path, N - 1)) {}
+	explicit AssetId(const std::string& path) : m_hash(hash(path.c_str(), path.length())) {}
+
+	constexpr uint32_t getHash() const { return m_hash; }
+	constexpr bool operator==(const AssetId& other) const { return m_hash == other.m_hash; }
+	constexpr bool operator!=(const AssetId& other) const { return m_hash != other.m_hash; }
+
+	// To key unordered containers
+	struct Hasher
+	{
+		size_t operator()(const AssetId& id) const { return id.m_hash; }
+	};
+
+private:
+	static constexpr uint32_t hash(const char* path, size_t length)
+	{
+		uint32_t value = 2166136261u;
+		for (size_t i = 0; i < length; ++i)
+		{
+			value = (value ^ (uint8_t)path[i]) * 16777619u;
+		}
+		return value;
+	}
+
+	uint32_t m_hash;
+};
+
+
+// An asset path known at compile time (i.e. the ASSET_ constants in gameData.h), along with its AssetId
+// The engine's load methods take it as well as a plain std::string, and use its id instead of hashing the path again
+// Note: it only points to the path, so it must be built from a string literal (or any other static string)
+class AssetPath final
+{
+public:
+	constexpr AssetPath() : m_path(""), m_id() {}
+	template<size_t N>
+	constexpr AssetPath(const char(&path)[N]) : m_path(path), m_id(path) {}
+
+	constexpr const char* c_str() const { return m_path; }
+	constexpr bool empty() const { return m_path[0] == '\0'; }
+	constexpr AssetId id() const { return m_id; }
+	operator std::string() const { return m_path; }
+
+private:
+	const char* m_path;
+	AssetId m_id;
+};
+
+
+#endif // !H_ASSET_ID
@@ -0,0 +1,460 @@
+#include "AssetPack.h"
+
+#include <vector>
+#include <string.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "SDL2_image/include/SDL_image.h"
+#include "globals.h"
+#include "SceneAssets.h"
+
+
+namespace
+{
+	// Layout (little endian): header, then one index record per entry, then the data of every entry (16 bytes aligned)
+	// Header: magic, version, entries count, audio frequency, audio format, audio channels
+	// Index record: name length, name, format, offset, size, width, height, pitch, pixel format
+	const char PACK_MAGIC[4] = { 'S', 'H', 'P', 'K' };
+	const Uint32 PACK_VERSION = 1;
+	const Uint32 HEADER_SIZE = 24;
+	// Index record size after the name
+	const Uint32 RECORD_FIELDS_SIZE = 28;
+	const Uint32 DATA_ALIGNMENT = 16;
+
+	Uint32 readUint32(const Uint8* data)
+	{
+		Uint32 value;
+		memcpy(&value, data, sizeof(value));
+		return SDL_SwapLE32(value);
+	}
+
+	struct PendingEntry
+	{
+		std::string name;
+		Uint32 format;
+		std::vector<Uint8> data;
+		Uint32 width = 0;
+		Uint32 height = 0;
+		Uint32 pitch = 0;
+		Uint32 pixelFormat = 0;
+		Uint32 offset = 0;
+	};
+}
+
+
+AssetPack::AssetPack()
+{
+}
+
+
+AssetPack::~AssetPack()
+{
+	close();
+}
+
+
+bool AssetPack::open(const std::string& path)
+{
+	close();
+
+	if (!mapFile(path))
+	{
+		return false;
+	}
+	if (!readIndex())
+	{
+		OutputLog("WARNING: The asset pack at %s is not valid and will be ignored!", path.c_str());
+		close();
+		return false;
+	}
+
+	OutputLog("INFO: Asset pack mapped from %s (%i assets, %i KB).", path.c_str(), (int)m_entries.size(), (int)(m_size / 1024));
+	return true;
+}
+
+
+void AssetPack::close()
+{
+	unmapFile();
+	m_entries.clear();
+}
+
+
+bool AssetPack::isOpen() const
+{
+	return m_data != nullptr;
+}
+
+
+SDL_Surface* AssetPack::loadSurface(const std::string& path) const
+{
+	const Entry* entry = findEntry(path, EntryFormat::SURFACE);
+	if (entry != nullptr)
+	{
+		void* pixels = const_cast<Uint8*>(m_data + entry->offset);
+		SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, entry->width, entry->height, SDL_BITSPERPIXEL(entry->pixelFormat), entry->pitch, entry->pixelFormat);
+		if (surface != nullptr)
+		{
+			return surface;
+		}
+	}
+	return IMG_Load(path.c_str());
+}
+
+
+Mix_Chunk* AssetPack::loadChunk(const std::string& path) const
+{
+	const Entry* entry = findEntry(path, EntryFormat::SAMPLES);
+	if (entry != nullptr)
+	{
+		// The samples can only be used as they are if the device was opened with the format they were converted to
+		int frequency;
+		Uint16 format;
+		int channels;
+		if (Mix_QuerySpec(&frequency, &format, &channels) != 0 && frequency == m_audioFrequency && format == m_audioFormat && channels == m_audioChannels)
+		{
+			Mix_Chunk* chunk = Mix_QuickLoad_RAW(const_cast<Uint8*>(m_data + entry->offset), entry->size);
+			if (chunk != nullptr)
+			{
+				return chunk;
+			}
+		}
+	}
+	return Mix_LoadWAV(path.c_str());
+}
+
+
+Mix_Music* AssetPack::loadMusic(const std::string& path) const
+{
+	const Entry* entry = findEntry(path, EntryFormat::FILE);
+	if (entry != nullptr)
+	{
+		SDL_RWops* rw = SDL_RWFromConstMem(m_data + entry->offset, entry->size);
+		if (rw != nullptr)
+		{
+			// Note: the music keeps reading from rw (and frees it) as it is streamed
+			Mix_Music* music = Mix_LoadMUS_RW(rw, 1);
+			if (music != nullptr)
+			{
+				return music;
+			}
+		}
+	}
+	return Mix_LoadMUS(path.c_str());
+}
+
+
+bool AssetPack::build(const std::string& path, const SceneAssets& assets, SDL_Renderer* renderer)
+{
+	int frequency = 0;
+	Uint16 audioFormat = 0;
+	int channels = 0;
+	if (Mix_QuerySpec(&frequency, &audioFormat, &channels) == 0)
+	{
+		OutputLog("ERROR: The audio device must be opened to build the asset pack!");
+		return false;
+	}
+	Uint32 pixelFormat = getNativePixelFormat(renderer);
+
+	// Convert every asset in memory first (the index needs to know all the sizes)
+	std::vector<PendingEntry> entries;
+	for (const std::string& imagePath : assets.images)
+	{
+		SDL_Surface* loadedSurface = IMG_Load(imagePath.c_str());
+		SDL_Surface* convertedSurface = loadedSurface != nullptr ? SDL_ConvertSurfaceFormat(loadedSurface, pixelFormat, 0) : nullptr;
+		SDL_FreeSurface(loadedSurface);
+		if (convertedSurface == nullptr)
+		{
+			OutputLog("WARNING: Unable to convert image at path %s for the asset pack! SDL Error: %s", imagePath.c_str(), SDL_GetError());
+			continue;
+		}
+		PendingEntry entry;
+		entry.name = imagePath;
+		entry.format = (Uint32)EntryFormat::SURFACE;
+		entry.width = convertedSurface->w;
+		entry.height = convertedSurface->h;
+		entry.pitch = convertedSurface->pitch;
+		entry.pixelFormat = pixelFormat;
+		const Uint8* pixels = static_cast<const Uint8*>(convertedSurface->pixels);
+		entry.data.assign(pixels, pixels + convertedSurface->pitch * convertedSurface->h);
+		SDL_FreeSurface(convertedSurface);
+		entries.push_back(std::move(entry));
+	}
+	for (const std::string& sfxPath : assets.sfx)
+	{
+		// Mix_LoadWAV already converts the samples to the format of the opened device
+		Mix_Chunk* chunk = Mix_LoadWAV(sfxPath.c_str());
+		if (chunk == nullptr)
+		{
+			OutputLog("WARNING: Unable to load sfx at path %s for the asset pack! Mix_LoadWAV: %s", sfxPath.c_str(), Mix_GetError());
+			continue;
+		}
+		PendingEntry entry;
+		entry.name = sfxPath;
+		entry.format = (Uint32)EntryFormat::SAMPLES;
+		entry.data.assign(chunk->abuf, chunk->abuf + chunk->alen);
+		Mix_FreeChunk(chunk);
+		entries.push_back(std::move(entry));
+	}
+	for (const std::string& musicPath : assets.music)
+	{
+		SDL_RWops* rw = SDL_RWFromFile(musicPath.c_str(), "rb");
+		Sint64 fileSize = rw != nullptr ? SDL_RWsize(rw) : -1;
+		PendingEntry entry;
+		entry.name = musicPath;
+		entry.format = (Uint32)EntryFormat::FILE;
+		entry.data.resize(fileSize > 0 ? (size_t)fileSize : 0);
+		if (fileSize <= 0 || SDL_RWread(rw, entry.data.data(), 1, entry.data.size()) != entry.data.size())
+		{
+			OutputLog("WARNING: Unable to read music at path %s for the asset pack! SDL Error: %s", musicPath.c_str(), SDL_GetError());
+			if (rw != nullptr)
+			{
+				SDL_RWclose(rw);
+			}
+			continue;
+		}
+		SDL_RWclose(rw);
+		entries.push_back(std::move(entry));
+	}
+
+	// Lay out the data after the index
+	Uint32 offset = HEADER_SIZE;
+	for (const PendingEntry& entry : entries)
+	{
+		offset += 4 + entry.name.size() + RECORD_FIELDS_SIZE;
+	}
+	for (PendingEntry& entry : entries)
+	{
+		offset = (offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+		entry.offset = offset;
+		offset += entry.data.size();
+	}
+
+	SDL_RWops* output = SDL_RWFromFile(path.c_str(), "wb");
+	if (output == nullptr)
+	{
+		OutputLog("ERROR: Unable to create the asset pack at %s! SDL Error: %s", path.c_str(), SDL_GetError());
+		return false;
+	}
+	bool success = SDL_RWwrite(output, PACK_MAGIC, 1, sizeof(PACK_MAGIC)) == sizeof(PACK_MAGIC);
+	success &= SDL_WriteLE32(output, PACK_VERSION) == 1;
+	success &= SDL_WriteLE32(output, entries.size()) == 1;
+	success &= SDL_WriteLE32(output, frequency) == 1;
+	success &= SDL_WriteLE32(output, audioFormat) == 1;
+	success &= SDL_WriteLE32(output, channels) == 1;
+	for (const PendingEntry& entry : entries)
+	{
+		success &= SDL_WriteLE32(output, entry.name.size()) == 1;
+		success &= SDL_RWwrite(output, entry.name.data(), 1, entry.name.size()) == entry.name.size();
+		success &= SDL_WriteLE32(output, entry.format) == 1;
+		success &= SDL_WriteLE32(output, entry.offset) == 1;
+		success &= SDL_WriteLE32(output, entry.data.size()) == 1;
+		success &= SDL_WriteLE32(output, entry.width) == 1;
+		success &= SDL_WriteLE32(output, entry.height) == 1;
+		success &= SDL_WriteLE32(output, entry.pitch) == 1;
+		success &= SDL_WriteLE32(output, entry.pixelFormat) == 1;
+	}
+	const Uint8 padding[DATA_ALIGNMENT] = {};
+	for (const PendingEntry& entry : entries)
+	{
+		Sint64 position = SDL_RWtell(output);
+		if (position < entry.offset)
+		{
+			success &= SDL_RWwrite(output, padding, 1, (size_t)(entry.offset - position)) == (size_t)(entry.offset - position);
+		}
+		success &= SDL_RWwrite(output, entry.data.data(), 1, entry.data.size()) == entry.data.size();
+	}
+	SDL_RWclose(output);
+
+	if (success)
+	{
+		OutputLog("INFO: Asset pack with %i assets (%i KB) written to %s.", (int)entries.size(), (int)(offset / 1024), path.c_str());
+	}
+	else
+	{
+		OutputLog("ERROR: Unable to write the asset pack at %s!", path.c_str());
+	}
+	return success;
+}
+
+
+Uint32 AssetPack::getNativePixelFormat(SDL_Renderer* renderer)
+{
+	SDL_RendererInfo rendererInfo;
+	if (renderer != nullptr && SDL_GetRendererInfo(renderer, &rendererInfo) == 0)
+	{
+		for (Uint32 i = 0; i < rendererInfo.num_texture_formats; ++i)
+		{
+			Uint32 format = rendererInfo.texture_formats[i];
+			if (!SDL_ISPIXELFORMAT_FOURCC(format) && SDL_BITSPERPIXEL(format) == 32 && SDL_ISPIXELFORMAT_ALPHA(format))
+			{
+				return format;
+			}
+		}
+	}
+	return SDL_PIXELFORMAT_ARGB8888;
+}
+
+
+bool AssetPack::readIndex()
+{
+	if (m_size < HEADER_SIZE || memcmp(m_data, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 || readUint32(m_data + 4) != PACK_VERSION)
+	{
+		return false;
+	}
+	Uint32 entriesCount = readUint32(m_data + 8);
+	m_audioFrequency = readUint32(m_data + 12);
+	m_audioFormat = (Uint16)readUint32(m_data + 16);
+	m_audioChannels = readUint32(m_data + 20);
+
+	size_t position = HEADER_SIZE;
+	for (Uint32 i = 0; i < entriesCount; ++i)
+	{
+		if (position + 4 > m_size)
+		{
+			return false;
+		}
+		Uint32 nameLength = readUint32(m_data + position);
+		position += 4;
+		if (position + nameLength + RECORD_FIELDS_SIZE > m_size)
+		{
+			return false;
+		}
+		std::string name(reinterpret_cast<const char*>(m_data + position), nameLength);
+		position += nameLength;
+
+		Entry entry;
+		entry.format = (EntryFormat)readUint32(m_data + position);
+		entry.offset = readUint32(m_data + position + 4);
+		entry.size = readUint32(m_data + position + 8);
+		entry.width = readUint32(m_data + position + 12);
+		entry.height = readUint32(m_data + position + 16);
+		entry.pitch = readUint32(m_data + position + 20);
+		entry.pixelFormat = readUint32(m_data + position + 24);
+		position += RECORD_FIELDS_SIZE;
+
+		if (!isEntryValid(entry))
+		{
+			OutputLog("WARNING: The asset pack entry for %s is not valid (the pack may be truncated or stale)!", name.c_str());
+			return false;
+		}
+		m_entries[name] = entry;
+	}
+	return true;
+}
+
+
+bool AssetPack::isEntryValid(const Entry& entry) const
+{
+	if ((Uint64)entry.offset + entry.size > m_size)
+	{
+		return false;
+	}
+
+	switch (entry.format)
+	{
+	case EntryFormat::FILE:
+	case EntryFormat::SAMPLES:
+		return true;
+	case EntryFormat::SURFACE:
+	{
+		// The pixels are handed to SDL as they are, so every row must lie inside the entry
+		if (entry.width <= 0 || entry.height <= 0 || SDL_ISPIXELFORMAT_FOURCC(entry.pixelFormat) || SDL_BYTESPERPIXEL(entry.pixelFormat) == 0)
+		{
+			return false;
+		}
+		Uint64 rowSize = (Uint64)entry.width * SDL_BYTESPERPIXEL(entry.pixelFormat);
+		return entry.pitch > 0 && (Uint64)entry.pitch >= rowSize && (Uint64)entry.pitch * entry.height <= entry.size;
+	}
+	}
+	return false;
+}
+
+
+const AssetPack::Entry* AssetPack::findEntry(const std::string& path, EntryFormat format) const
+{
+	if (m_data != nullptr)
+	{
+		auto it = m_entries.find(path);
+		if (it != m_entries.end() && it->second.format == format)
+		{
+			return &it->second;
+		}
+	}
+	return nullptr;
+}
+
+
+bool AssetPack::mapFile(const std::string& path)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	HANDLE mapping = GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+	const void* view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (view == nullptr)
+	{
+		OutputLog("WARNING: Unable to map the asset pack at %s! Error: %lu", path.c_str(), GetLastError());
+		if (mapping != nullptr)
+		{
+			CloseHandle(mapping);
+		}
+		CloseHandle(file);
+		return false;
+	}
+	m_fileHandle = file;
+	m_mappingHandle = mapping;
+	m_data = static_cast<const Uint8*>(view);
+	m_size = (size_t)fileSize.QuadPart;
+#else
+	int file = ::open(path.c_str(), O_RDONLY);
+	if (file == -1)
+	{
+		return false;
+	}
+	struct stat fileStats;
+	void* view = fstat(file, &fileStats) == 0 && fileStats.st_size > 0 ? mmap(nullptr, fileStats.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+	// The mapping stays valid once the file is closed
+	::close(file);
+	if (view == MAP_FAILED)
+	{
+		OutputLog("WARNING: Unable to map the asset pack at %s!", path.c_str());
+		return false;
+	}
+	m_data = static_cast<const Uint8*>(view);
+	m_size = (size_t)fileStats.st_size;
+#endif
+	return true;
+}
+
+
+void AssetPack::unmapFile()
+{
+	if (m_data == nullptr)
+	{
+		return;
+	}
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+	CloseHandle(m_mappingHandle);
+	CloseHandle(m_fileHandle);
+	m_mappingHandle = nullptr;
+	m_fileHandle = nullptr;
+#else
+	munmap(const_cast<Uint8*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
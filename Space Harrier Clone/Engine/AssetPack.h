@@ -0,0 +1,76 @@
+#ifndef H_ASSET_PACK
+#define H_ASSET_PACK
+
+#include <string>
+#include <unordered_map>
+#include "SDL2/include/SDL_render.h"
+#include "SDL2_mixer/include/SDL_mixer.h"
+struct SceneAssets;
+
+
+// A single file holding the game assets, memory-mapped at startup and read in place
+// Images are stored already converted to the renderer's pixel format, and SFX as samples in the audio device format,
+// so loading them only wraps the mapped memory (music stays compressed, since it is streamed)
+// Assets missing from the pack (or with no pack at all) are loaded from their own files, as usual
+// Note: every load method may be called from any thread
+class AssetPack final
+{
+public:
+	AssetPack();
+	~AssetPack();
+
+	bool open(const std::string& path);
+	void close();
+	bool isOpen() const;
+
+	// Images from the pack point to its (read-only) memory, so their pixels must not be written
+	SDL_Surface* loadSurface(const std::string& path) const;
+	// SFX from the pack point to its memory (Mix_FreeChunk only frees the chunk)
+	Mix_Chunk* loadChunk(const std::string& path) const;
+	Mix_Music* loadMusic(const std::string& path) const;
+
+	// Writes a pack with the listed files, converted for renderer and the opened audio device
+	static bool build(const std::string& path, const SceneAssets& assets, SDL_Renderer* renderer);
+	// The first 32 bits format with alpha supported by renderer (textures in that format are uploaded without conversion)
+	static Uint32 getNativePixelFormat(SDL_Renderer* renderer);
+
+private:
+	enum class EntryFormat
+	{
+		FILE,
+		SURFACE,
+		SAMPLES
+	};
+
+	struct Entry
+	{
+		EntryFormat format;
+		Uint32 offset;
+		Uint32 size;
+		// Surfaces only
+		int width;
+		int height;
+		int pitch;
+		Uint32 pixelFormat;
+	};
+
+	bool readIndex();
+	// Whether entry lies inside the mapped pack (and, for surfaces, whether its pixels fit in the entry)
+	bool isEntryValid(const Entry& entry) const;
+	const Entry* findEntry(const std::string& path, EntryFormat format) const;
+	bool mapFile(const std::string& path);
+	void unmapFile();
+
+	const Uint8* m_data = nullptr;
+	size_t m_size = 0;
+	void* m_fileHandle = nullptr;
+	void* m_mappingHandle = nullptr;
+	std::unordered_map<std::string, Entry> m_entries;
+	// Format of the SFX samples (only used if it matches the opened audio device)
+	int m_audioFrequency = 0;
+	Uint16 m_audioFormat = 0;
+	int m_audioChannels = 0;
+};
+
+
+#endif // !H_ASSET_PACK
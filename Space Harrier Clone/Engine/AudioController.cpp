@@ -4,6 +4,11 @@
 #include "Music.h"
 #include "SFX.h"
 #include "engineUtils.h"
+#include "Engine.h"
+#include "SceneManager.h"
+#include "SceneAssetsLoader.h"
+#include "AssetPack.h"
+#include "ResourceCache.h"
 
 
 AudioController::AudioController()
@@ -13,31 +18,45 @@ AudioController::AudioController()
 
 AudioController::~AudioController()
 {
-	OutputLog("INFO: Freeing audio system and audio resources");
-	for (auto ptr : musicPtrs)
-	{
-		Mix_FreeMusic(ptr);
-	}
-	musicPtrs.clear();
-	for (auto ptr : sfxPtrs)
-	{
-		Mix_FreeChunk(ptr);
-	}
-	sfxPtrs.clear();
 }
 
 
 Music AudioController::loadMusic(const std::string& path)
 {
-	Mix_Music* sdlMusic = nullptr;
-	sdlMusic = Mix_LoadMUS(path.c_str());
+	return loadMusic(AssetId(path), path.c_str());
+}
+
+
+Music AudioController::loadMusic(const AssetPath& asset)
+{
+	return loadMusic(asset.id(), asset.c_str());
+}
+
+
+Music AudioController::loadMusic(AssetId id, const char* assetPath)
+{
+	// Music already loaded is shared
+	Mix_Music* sdlMusic = engine->resources->acquireMusic(id);
+	if (sdlMusic != nullptr)
+	{
+		return Music(sdlMusic);
+	}
+	std::string path(assetPath);
+
+	// Music decoded along with the scene is used first
+	sdlMusic = engine->sceneManager->getSceneAssets()->takeMusic(path);
+	if (sdlMusic == nullptr)
+	{
+		sdlMusic = engine->assetPack->loadMusic(path);
+	}
 	if (sdlMusic == nullptr)
 	{
 		OutputLog("WARNING: Could not load music with path: %s. Mix_LoadMUS: %s", path.c_str(), Mix_GetError());
 	}
-	else
+	else if (!engine->resources->addMusic(id, path, sdlMusic))
 	{
-		musicPtrs.push_back(sdlMusic);
+		Mix_FreeMusic(sdlMusic);
+		sdlMusic = nullptr;
 	}
 	return Music(sdlMusic);
 }
@@ -45,11 +64,8 @@ Music AudioController::loadMusic(const std::string& path)
 
 bool AudioController::unloadMusic(Music& music)
 {
-	auto it = std::find(musicPtrs.begin(), musicPtrs.end(), music.m_music);
-	if (it != musicPtrs.end())
+	if (engine->resources->release(music.m_music))
 	{
-		Mix_FreeMusic(*it);
-		musicPtrs.erase(it);
 		music.m_music = nullptr;
 		return true;
 	}
@@ -60,25 +76,46 @@ bool AudioController::unloadMusic(Music& music)
 void AudioController::unloadAllMusic()
 {
 	stopMusic();
-	for (auto ptr : musicPtrs)
-	{
-		Mix_FreeMusic(ptr);
-	}
-	musicPtrs.clear();
+	engine->resources->releaseAll(ResourceCache::ResourceType::MUSIC);
 }
 
 
 SFX AudioController::loadSFX(const std::string& path)
 {
-	Mix_Chunk* sdlSfx = nullptr;
-	sdlSfx = Mix_LoadWAV(path.c_str());
+	return loadSFX(AssetId(path), path.c_str());
+}
+
+
+SFX AudioController::loadSFX(const AssetPath& asset)
+{
+	return loadSFX(asset.id(), asset.c_str());
+}
+
+
+SFX AudioController::loadSFX(AssetId id, const char* assetPath)
+{
+	// SFX already loaded are shared
+	Mix_Chunk* sdlSfx = engine->resources->acquireSFX(id);
+	if (sdlSfx != nullptr)
+	{
+		return SFX(sdlSfx);
+	}
+	std::string path(assetPath);
+
+	// SFX decoded along with the scene only need to be copied
+	sdlSfx = engine->sceneManager->getSceneAssets()->createChunk(path);
+	if (sdlSfx == nullptr)
+	{
+		sdlSfx = engine->assetPack->loadChunk(path);
+	}
 	if (sdlSfx == nullptr)
 	{
 		OutputLog("WARNING: Could not load sfx with path: %s. Mix_LoadWAV: %s", path.c_str(), Mix_GetError());
 	}
-	else
+	else if (!engine->resources->addSFX(id, path, sdlSfx))
 	{
-		sfxPtrs.push_back(sdlSfx);
+		Mix_FreeChunk(sdlSfx);
+		sdlSfx = nullptr;
 	}
 	return SFX(sdlSfx);
 }
@@ -86,11 +123,8 @@ SFX AudioController::loadSFX(const std::string& path)
 
 bool AudioController::unloadSFX(SFX& sfx)
 {
-	auto it = std::find(sfxPtrs.begin(), sfxPtrs.end(), sfx.m_sfx);
-	if (it != sfxPtrs.end())
+	if (engine->resources->release(sfx.m_sfx))
 	{
-		Mix_FreeChunk(*it);
-		sfxPtrs.erase(it);
 		sfx.m_sfx = nullptr;
 		return true;
 	}
@@ -101,16 +135,16 @@ bool AudioController::unloadSFX(SFX& sfx)
 void AudioController::unloadAllSFX()
 {
 	Mix_HaltChannel(-1);
-	for (auto ptr : sfxPtrs)
-	{
-		Mix_FreeChunk(ptr);
-	}
-	sfxPtrs.clear();
+	engine->resources->releaseAll(ResourceCache::ResourceType::SFX);
 }
 
 
 void AudioController::playMusic(const Music& music, int repetitions) const
 {
+	if (!m_isEnabled)
+	{
+		return;
+	}
 	Mix_Music* sdlMusic = music.m_music;
 	if (Mix_PlayMusic(sdlMusic, repetitions) != 0)
 	{
@@ -121,18 +155,30 @@ void AudioController::playMusic(const Music& music, int repetitions) const
 
 void AudioController::pauseMusic() const
 {
+	if (!m_isEnabled)
+	{
+		return;
+	}
 	Mix_PauseMusic();
 }
 
 
 void AudioController::unpauseMusic() const
 {
+	if (!m_isEnabled)
+	{
+		return;
+	}
 	Mix_ResumeMusic();
 }
 
 
 void AudioController::stopMusic() const
 {
+	if (!m_isEnabled)
+	{
+		return;
+	}
 	Mix_HaltMusic();
 }
 
@@ -168,6 +214,10 @@ void AudioController::setMusicVolume(float normalizedVolume) const
 
 void AudioController::playSFX(const SFX& sfx, int repetitions) const
 {
+	if (!m_isEnabled)
+	{
+		return;
+	}
 	Mix_Chunk* sdlSfx = sfx.m_sfx;
 	if (Mix_PlayChannel(-1, sdlSfx, repetitions) == -1)
 	{
@@ -191,3 +241,20 @@ void AudioController::setSFXVolume(float normalizedVolume) const
 	normalizedVolume = EngineUtils::clamp(normalizedVolume, 0, 1);
 	Mix_Volume(-1, (int)(normalizedVolume * MAX_VOLUME));
 }
+
+
+void AudioController::setEnabled(bool isEnabled)
+{
+	if (!isEnabled)
+	{
+		Mix_HaltChannel(-1);
+		Mix_HaltMusic();
+	}
+	m_isEnabled = isEnabled;
+}
+
+
+bool AudioController::isEnabled() const
+{
+	return m_isEnabled;
+}
@@ -1,9 +1,9 @@
 #ifndef H_AUDIO_CONTROLLER
 #define H_AUDIO_CONTROLLER
 
-#include <list>
 #include <string>
 #include "SDL2_mixer/include/SDL_mixer.h"
+#include "AssetId.h"
 struct Music;
 struct SFX;
 
@@ -14,9 +14,11 @@ public:
 	~AudioController();
 
 	Music loadMusic(const std::string& path);
+	Music loadMusic(const AssetPath& asset);
 	bool unloadMusic(Music& music);
 	void unloadAllMusic();
 	SFX loadSFX(const std::string& path);
+	SFX loadSFX(const AssetPath& asset);
 	bool unloadSFX(SFX& sfx);
 	void unloadAllSFX();
 
@@ -33,9 +35,16 @@ public:
 	float getSFXAverageVolume() const;
 	void setSFXVolume(float normalizedVolume) const;
 
+	// A disabled AudioController still loads audio, but never plays it (used when running headless)
+	void setEnabled(bool isEnabled);
+	bool isEnabled() const;
+
 private:
-	std::list<Mix_Music*> musicPtrs;
-	std::list<Mix_Chunk*> sfxPtrs;
+	// The path is only used (and copied) when the audio has to be loaded
+	Music loadMusic(AssetId id, const char* assetPath);
+	SFX loadSFX(AssetId id, const char* assetPath);
+
+	bool m_isEnabled = true;
 
 	const int MAX_VOLUME = 128;
 };
@@ -10,6 +10,8 @@ Behaviour::Behaviour()
 	m_type = ComponentType::BEHAVIOUR;
 	m_isAwake = false;
 	m_started = false;
+	m_isQueuedToStart = false;
+	m_overridesUpdate = true;
 }
 
 
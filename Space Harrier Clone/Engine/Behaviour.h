@@ -11,6 +11,7 @@ class Behaviour :
 	public Component
 {
 	friend class BehavioursManager;
+	friend class ComponentsManager;
 
 public:	
 	Behaviour();
@@ -28,9 +29,17 @@ public:
 	virtual void onTriggerStay(Reference<Collider>& other);
 	virtual void onTriggerExit(Reference<Collider>& other);
 
+	// Types can shadow this with true when their update only writes to their own gameObject (and its children),
+	// and only reads shared state that is not written during the update. Their instances are then updated in parallel,
+	// so any other side effect must go through Jobs::defer
+	static const bool IS_PARALLEL_SAFE = false;
+
 private:
 	bool m_isAwake;
 	bool m_started;
+	bool m_isQueuedToStart;
+	// Set at creation time (behaviours that don't override update are never visited by the update loop)
+	bool m_overridesUpdate;
 };
 
 
@@ -0,0 +1,123 @@
+#include "BehaviourProfiler.h"
+
+#include <algorithm>
+#include "SDL2/include/SDL_timer.h"
+#include "globals.h"
+#include "TypeId.h"
+
+
+BehaviourProfiler::BehaviourProfiler()
+{
+	m_counterToMS = 1000.0f / SDL_GetPerformanceFrequency();
+}
+
+
+BehaviourProfiler::~BehaviourProfiler()
+{
+}
+
+
+void BehaviourProfiler::beginUpdate()
+{
+	for (BehaviourTypeStats& stats : m_updateStats)
+	{
+		stats.calls = 0;
+		stats.totalTime = 0;
+		stats.maxTime = 0;
+		stats.timedCalls = 0;
+	}
+}
+
+
+void BehaviourProfiler::addSample(int typeId, Uint64 counterTicks)
+{
+	recordSamples(typeId, 1, counterTicks, true);
+}
+
+
+void BehaviourProfiler::addSamples(int typeId, int calls, Uint64 counterTicks)
+{
+	if (calls > 0)
+	{
+		recordSamples(typeId, calls, counterTicks, false);
+	}
+}
+
+
+void BehaviourProfiler::recordSamples(int typeId, int calls, Uint64 counterTicks, bool isTimedAlone)
+{
+	if (typeId < 0)
+	{
+		return;
+	}
+	if (typeId >= (int)m_updateStats.size())
+	{
+		m_updateStats.resize(typeId + 1);
+		m_sessionStats.resize(typeId + 1);
+	}
+
+	float time = counterTicks * m_counterToMS;
+	addToStats(m_updateStats[typeId], typeId, calls, time, isTimedAlone);
+	addToStats(m_sessionStats[typeId], typeId, calls, time, isTimedAlone);
+}
+
+
+std::vector<BehaviourTypeStats> BehaviourProfiler::getTopTypes(int count, bool wholeSession) const
+{
+	std::vector<BehaviourTypeStats> topTypes;
+	for (const BehaviourTypeStats& stats : wholeSession ? m_sessionStats : m_updateStats)
+	{
+		if (stats.calls > 0)
+		{
+			topTypes.push_back(stats);
+		}
+	}
+
+	std::sort(topTypes.begin(), topTypes.end(), [](const BehaviourTypeStats& lhs, const BehaviourTypeStats& rhs) -> bool { return lhs.totalTime > rhs.totalTime; });
+	if ((int)topTypes.size() > count)
+	{
+		topTypes.resize(count);
+	}
+	return topTypes;
+}
+
+
+void BehaviourProfiler::logReport(int count) const
+{
+#if BEHAVIOUR_PROFILING
+	for (bool wholeSession : { false, true })
+	{
+		OutputLog("INFO: Top %i Behaviour types by update time (%s):", count, wholeSession ? "session" : "last update");
+		for (const BehaviourTypeStats& stats : getTopTypes(count, wholeSession))
+		{
+			if (stats.timedCalls > 0)
+			{
+				OutputLog("INFO:   %-40s calls: %8i  total: %9.3f ms  max: %7.3f ms", TypeId::name(stats.typeId), stats.calls, stats.totalTime, stats.maxTime);
+			}
+			else
+			{
+				OutputLog("INFO:   %-40s calls: %8i  total: %9.3f ms  max:       - ms", TypeId::name(stats.typeId), stats.calls, stats.totalTime);
+			}
+		}
+	}
+#else
+	(void)count;
+	OutputLog("INFO: Behaviour profiling is compiled out of this build (see BEHAVIOUR_PROFILING).");
+#endif
+}
+
+
+void BehaviourProfiler::addToStats(BehaviourTypeStats& stats, int typeId, int calls, float time, bool isTimedAlone)
+{
+	stats.typeId = typeId;
+	stats.calls += calls;
+	stats.totalTime += time;
+	if (isTimedAlone)
+	{
+		++stats.timedCalls;
+		if (time > stats.maxTime)
+		{
+			stats.maxTime = time;
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef H_BEHAVIOUR_PROFILER
+#define H_BEHAVIOUR_PROFILER
+
+#include <vector>
+#include "SDL2/include/SDL_stdinc.h"
+
+// Per-type timing of BehavioursManager::update (two counter reads per behaviour), only compiled in Debug builds by default
+// Define BEHAVIOUR_PROFILING as 1 (or 0) in the project settings to override it
+#ifndef BEHAVIOUR_PROFILING
+#ifdef _DEBUG
+#define BEHAVIOUR_PROFILING 1
+#else
+#define BEHAVIOUR_PROFILING 0
+#endif
+#endif
+
+
+struct BehaviourTypeStats
+{
+	int typeId = -1;
+	int calls = 0;
+	float totalTime = 0;
+	// Only known for the calls timed one by one (timedCalls)
+	float maxTime = 0;
+	int timedCalls = 0;
+};
+
+
+// Aggregates the cost of Behaviour::update per concrete Behaviour type, for the last update and for the whole session
+class BehaviourProfiler final
+{
+public:
+	BehaviourProfiler();
+	~BehaviourProfiler();
+
+	void beginUpdate();
+	void addSample(int typeId, Uint64 counterTicks);
+	// Calls timed as a whole (i.e. a group updated in parallel): they add to the calls and the total time, but not to the max
+	void addSamples(int typeId, int calls, Uint64 counterTicks);
+
+	// The types with the highest total time (sorted)
+	std::vector<BehaviourTypeStats> getTopTypes(int count, bool wholeSession) const;
+	void logReport(int count) const;
+
+private:
+	void recordSamples(int typeId, int calls, Uint64 counterTicks, bool isTimedAlone);
+	void addToStats(BehaviourTypeStats& stats, int typeId, int calls, float time, bool isTimedAlone);
+
+	float m_counterToMS = 0;
+	std::vector<BehaviourTypeStats> m_updateStats;
+	std::vector<BehaviourTypeStats> m_sessionStats;
+};
+
+
+#endif // !H_BEHAVIOUR_PROFILER
@@ -0,0 +1,77 @@
+#include "BehaviourTypeRegistry.h"
+
+#include "gameConfig.h"
+#include "Engine.h"
+#include "JobSystem.h"
+
+
+GroupUpdater BehaviourTypeRegistry::getUpdater(int typeId)
+{
+	std::vector<GroupUpdater>& registeredUpdaters = updaters();
+	if (typeId >= 0 && typeId < (int)registeredUpdaters.size())
+	{
+		return registeredUpdaters[typeId];
+	}
+	return nullptr;
+}
+
+
+int BehaviourTypeRegistry::getUpdateOrder(int typeId)
+{
+	std::vector<int>& orders = updateOrders();
+	if (typeId >= 0 && typeId < (int)orders.size())
+	{
+		return orders[typeId];
+	}
+	return 0;
+}
+
+
+void BehaviourTypeRegistry::runInParallel(int count, const std::function<void(int, int)>& rangeUpdate)
+{
+	engine->jobSystem->parallelFor(count, PARALLEL_UPDATE_MIN_CHUNK, rangeUpdate);
+}
+
+
+void BehaviourTypeRegistry::registerUpdater(int typeId, GroupUpdater updater)
+{
+	static const std::vector<int> s_configuredOrder = behaviourUpdateOrderConfig();
+	static int s_registeredCount = 0;
+
+	std::vector<GroupUpdater>& registeredUpdaters = updaters();
+	std::vector<int>& orders = updateOrders();
+	if (typeId >= (int)registeredUpdaters.size())
+	{
+		registeredUpdaters.resize(typeId + 1, nullptr);
+		orders.resize(typeId + 1, 0);
+	}
+	registeredUpdaters[typeId] = updater;
+
+	// Unlisted types go after all the listed ones
+	int order = s_configuredOrder.size() + s_registeredCount;
+	for (unsigned int i = 0; i < s_configuredOrder.size(); ++i)
+	{
+		if (s_configuredOrder[i] == typeId)
+		{
+			order = i;
+			break;
+		}
+	}
+	orders[typeId] = order;
+	++s_registeredCount;
+}
+
+
+std::vector<GroupUpdater>& BehaviourTypeRegistry::updaters()
+{
+	// Function-local so that it is initialized before any type registers itself
+	static std::vector<GroupUpdater> s_updaters;
+	return s_updaters;
+}
+
+
+std::vector<int>& BehaviourTypeRegistry::updateOrders()
+{
+	static std::vector<int> s_updateOrders;
+	return s_updateOrders;
+}
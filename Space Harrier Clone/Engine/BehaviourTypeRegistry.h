@@ -0,0 +1,127 @@
+#ifndef H_BEHAVIOUR_TYPE_REGISTRY
+#define H_BEHAVIOUR_TYPE_REGISTRY
+
+#include <vector>
+#include <functional>
+#include "Reference.h"
+#include "TypeId.h"
+#include "BehaviourProfiler.h"
+#if BEHAVIOUR_PROFILING
+#include <atomic>
+#include "SDL2/include/SDL_timer.h"
+#include "Engine.h"
+#endif
+class Component;
+
+
+// Updates a contiguous run of behaviours that share the same concrete type
+typedef void(*GroupUpdater)(Reference<Component>* behaviours, int count);
+
+
+// Per concrete Behaviour type: the function that updates a group of them (calling T::update non-virtually),
+// and the position of the type in the update order
+class BehaviourTypeRegistry final
+{
+public:
+	// Called for every created Behaviour that overrides update
+	template<typename T>
+	static void registerType();
+
+	// nullptr if the type was never registered
+	static GroupUpdater getUpdater(int typeId);
+	// Types listed in behaviourUpdateOrderConfig come first (in that order), the rest follow in registration order
+	static int getUpdateOrder(int typeId);
+
+private:
+	template<typename T>
+	static void updateGroup(Reference<Component>* behaviours, int count);
+	template<typename T>
+	static void updateGroupInParallel(Reference<Component>* behaviours, int count);
+	// Returns how many behaviours were actually updated (the active ones)
+	template<typename T>
+	static int updateRange(Reference<Component>* behaviours, int count);
+
+	// Splits the update in chunks for the JobSystem
+	static void runInParallel(int count, const std::function<void(int, int)>& rangeUpdate);
+
+	static void registerUpdater(int typeId, GroupUpdater updater);
+
+	static std::vector<GroupUpdater>& updaters();
+	static std::vector<int>& updateOrders();
+};
+
+
+template<typename T>
+void BehaviourTypeRegistry::registerType()
+{
+	int typeId = TypeId::of<T>();
+	if (getUpdater(typeId) == nullptr)
+	{
+		registerUpdater(typeId, T::IS_PARALLEL_SAFE ? &updateGroupInParallel<T> : &updateGroup<T>);
+	}
+}
+
+
+template<typename T>
+void BehaviourTypeRegistry::updateGroup(Reference<Component>* behaviours, int count)
+{
+#if BEHAVIOUR_PROFILING
+	BehaviourProfiler* profiler = engine->behaviourProfiler;
+	int typeId = TypeId::of<T>();
+	for (int i = 0; i < count; ++i)
+	{
+		T* behaviourPtr = static_cast<T*>(behaviours[i].get());
+		// The active state is checked again, since it may change while updating
+		if (behaviourPtr->gameObject()->isActive())
+		{
+			Uint64 startCounter = SDL_GetPerformanceCounter();
+			behaviourPtr->T::update();
+			profiler->addSample(typeId, SDL_GetPerformanceCounter() - startCounter);
+		}
+	}
+#else
+	updateRange<T>(behaviours, count);
+#endif
+}
+
+
+template<typename T>
+void BehaviourTypeRegistry::updateGroupInParallel(Reference<Component>* behaviours, int count)
+{
+#if BEHAVIOUR_PROFILING
+	// The profiler is not thread safe, so the group is timed as a whole (along with the number of behaviours it updated)
+	std::atomic<int> updatedCount(0);
+	Uint64 startCounter = SDL_GetPerformanceCounter();
+	runInParallel(count, [behaviours, &updatedCount](int begin, int end)
+	{
+		updatedCount += updateRange<T>(behaviours + begin, end - begin);
+	});
+	engine->behaviourProfiler->addSamples(TypeId::of<T>(), updatedCount, SDL_GetPerformanceCounter() - startCounter);
+#else
+	runInParallel(count, [behaviours](int begin, int end)
+	{
+		updateRange<T>(behaviours + begin, end - begin);
+	});
+#endif
+}
+
+
+template<typename T>
+int BehaviourTypeRegistry::updateRange(Reference<Component>* behaviours, int count)
+{
+	int updatedCount = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		T* behaviourPtr = static_cast<T*>(behaviours[i].get());
+		// The active state is checked again, since it may change while updating
+		if (behaviourPtr->gameObject()->isActive())
+		{
+			behaviourPtr->T::update();
+			++updatedCount;
+		}
+	}
+	return updatedCount;
+}
+
+
+#endif // !H_BEHAVIOUR_TYPE_REGISTRY
@@ -3,6 +3,10 @@
 #include "Behaviour.h"
 #include "ComponentType.h"
 #include "GameObject.h"
+#include "BehaviourProfiler.h"
+#if BEHAVIOUR_PROFILING
+#include "Engine.h"
+#endif
 
 
 BehavioursManager::BehavioursManager()
@@ -25,42 +29,143 @@ void BehavioursManager::update()
 {
 	// Note: refreshComponents ensures that all Reference in m_components are valid, so they can be safely used
 	refreshComponents();
-	for (Reference<Component>& componentRef : m_components)
+	// Only the behaviours subscribed by the refresh above get awaken in this update
+	std::vector<Reference<Component>> behavioursToAwake;
+	behavioursToAwake.swap(m_behavioursToAwake);
+
+	// Behaviours started now join the active partition on the next refresh (so they get their first update in the next tick)
+	startBehaviours();
+
+	// Types are kept contiguous (and in update order) inside the active partition
+	if (m_hasActivePartitionChanged)
 	{
-		Behaviour* behaviourPtr = static_cast<Behaviour*>(componentRef.get());
-		// Actual update
-		if (!behaviourPtr->m_isAwake)
-		{
-			behaviourPtr->awake();
-			behaviourPtr->m_isAwake = true;
-		}
-		else if (behaviourPtr->gameObject()->isActive())
+		regroupBehaviours();
+	}
+
+#if BEHAVIOUR_PROFILING
+	engine->behaviourProfiler->beginUpdate();
+#endif
+	// Only the active partition needs to be visited, one type at a time
+	for (const UpdateGroup& group : m_updateGroups)
+	{
+		group.updater(&m_components[group.firstSlot], group.count);
+	}
+
+	// Newly subscribed behaviours were at the end of the list, so they are awaken last (and in subscription order)
+	awakeBehaviours(behavioursToAwake);
+}
+
+
+bool BehavioursManager::init()
+{
+	return true;
+}
+
+
+void BehavioursManager::close()
+{
+}
+
+
+bool BehavioursManager::initializeComponent(Reference<Component>& component)
+{
+	m_behavioursToAwake.push_back(component);
+	return true;
+}
+
+
+bool BehavioursManager::isComponentActive(const Component& component) const
+{
+	const Behaviour& behaviour = static_cast<const Behaviour&>(component);
+	return behaviour.m_overridesUpdate && behaviour.m_started && behaviour.gameObject()->isActive();
+}
+
+
+void BehavioursManager::onComponentActiveStateChanged(Component* component)
+{
+	ComponentManager::onComponentActiveStateChanged(component);
+
+	// Behaviours waiting for their gameObject to be activated can be started now
+	Behaviour* behaviourPtr = static_cast<Behaviour*>(component);
+	if (behaviourPtr->m_isAwake && behaviourPtr->gameObject()->isActive())
+	{
+		queueToStart(behaviourPtr);
+	}
+}
+
+
+void BehavioursManager::startBehaviours()
+{
+	std::vector<Reference<Component>> behavioursToStart;
+	behavioursToStart.swap(m_behavioursToStart);
+	for (Reference<Component>& componentRef : behavioursToStart)
+	{
+		if (componentRef)
 		{
-			if (!behaviourPtr->m_started) {
+			Behaviour* behaviourPtr = static_cast<Behaviour*>(componentRef.get());
+			behaviourPtr->m_isQueuedToStart = false;
+			// If the gameObject is inactive, the behaviour gets queued again once it is activated
+			if (!behaviourPtr->m_started && behaviourPtr->gameObject()->isActive())
+			{
 				behaviourPtr->start();
 				behaviourPtr->m_started = true;
+				if (behaviourPtr->m_overridesUpdate)
+				{
+					m_componentsToRefreshActive.push_back(behaviourPtr->m_self);
+				}
 			}
-			else
+		}
+	}
+}
+
+
+void BehavioursManager::awakeBehaviours(std::vector<Reference<Component>>& behavioursToAwake)
+{
+	for (Reference<Component>& componentRef : behavioursToAwake)
+	{
+		if (componentRef)
+		{
+			Behaviour* behaviourPtr = static_cast<Behaviour*>(componentRef.get());
+			if (!behaviourPtr->m_isAwake)
 			{
-				behaviourPtr->update();
+				behaviourPtr->awake();
+				behaviourPtr->m_isAwake = true;
+				queueToStart(behaviourPtr);
 			}
 		}
 	}
 }
 
 
-bool BehavioursManager::init()
+void BehavioursManager::queueToStart(Behaviour* behaviour)
 {
-	return true;
+	if (!behaviour->m_started && !behaviour->m_isQueuedToStart)
+	{
+		behaviour->m_isQueuedToStart = true;
+		m_behavioursToStart.push_back(behaviour->m_self);
+	}
 }
 
 
-void BehavioursManager::close()
+void BehavioursManager::regroupBehaviours()
 {
+	m_hasActivePartitionChanged = false;
+	sortActivePartition(&compareUpdateOrder);
+
+	m_updateGroups.clear();
+	for (int i = 0; i < m_activeCount; ++i)
+	{
+		int typeId = m_components[i]->getTypeId();
+		if (m_updateGroups.empty() || m_components[i - 1]->getTypeId() != typeId)
+		{
+			m_updateGroups.push_back(UpdateGroup{ BehaviourTypeRegistry::getUpdater(typeId), i, 0 });
+		}
+		++m_updateGroups.back().count;
+	}
 }
 
 
-bool BehavioursManager::initializeComponent(Reference<Component>& component)
+bool BehavioursManager::compareUpdateOrder(const Reference<Component>& behaviour1, const Reference<Component>& behaviour2)
 {
-	return true;
+	return BehaviourTypeRegistry::getUpdateOrder(behaviour1->getTypeId()) < BehaviourTypeRegistry::getUpdateOrder(behaviour2->getTypeId());
 }
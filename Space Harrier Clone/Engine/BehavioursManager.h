@@ -1,9 +1,12 @@
 #ifndef H_BEHAVIOURS_MANAGER
 #define H_BEHAVIOURS_MANAGER
 
+#include <vector>
 #include "ComponentManager.h"
 #include "Reference.h"
+#include "BehaviourTypeRegistry.h"
 class Component;
+class Behaviour;
 
 
 class BehavioursManager final :
@@ -23,6 +26,30 @@ private:
 	virtual bool init() override;
 	virtual void close() override;
 	virtual bool initializeComponent(Reference<Component>& component) override;
+	// The active partition holds the started behaviours that override update and whose gameObject is active
+	// (regardless of their own active state)
+	virtual bool isComponentActive(const Component& component) const override;
+	virtual void onComponentActiveStateChanged(Component* component) override;
+
+	void startBehaviours();
+	void awakeBehaviours(std::vector<Reference<Component>>& behavioursToAwake);
+	void queueToStart(Behaviour* behaviour);
+	void regroupBehaviours();
+	static bool compareUpdateOrder(const Reference<Component>& behaviour1, const Reference<Component>& behaviour2);
+
+	// One-shot queues: behaviours get awaken once subscribed (even if they are inactive),
+	// and started the first time their gameObject is active after that
+	std::vector<Reference<Component>> m_behavioursToAwake;
+	std::vector<Reference<Component>> m_behavioursToStart;
+
+	// Runs of same-typed behaviours in the active partition (sorted by update order), each updated in a single call
+	struct UpdateGroup
+	{
+		GroupUpdater updater;
+		int firstSlot;
+		int count;
+	};
+	std::vector<UpdateGroup> m_updateGroups;
 };
 
 
@@ -33,18 +33,15 @@ void CollidersManager::update()
 {
 	// Note: refreshComponents ensures that all Reference in m_components are valid, so they can be safely used
 	refreshComponents();
-	// Ensure we have at least 2 components to handle (needed to avoid the for-loops to attempt to access out of range)
-	if (m_components.size() < 2)
-	{
-		return;
-	}
-	for (unsigned int i = 0; i < m_components.size() - 1; ++i)
+	// Only the active partition is visited, but the active state is still checked since it may change during the loop
+	// Note: the signed bounds make the loops do nothing with less than 2 active components
+	for (int i = 0; i < m_activeCount - 1; ++i)
 	{
 		Reference<Component>& componentRef1 = m_components[i];
 		Collider* collider1 = static_cast<Collider*>(componentRef1.get());
 		if (collider1->isActive())
 		{
-			for (unsigned int j = i + 1; j < m_components.size(); ++j)
+			for (int j = i + 1; j < m_activeCount; ++j)
 			{
 				Reference<Component>& componentRef2 = m_components[j];
 				Collider* collider2 = static_cast<Collider*>(componentRef2.get());
@@ -3,6 +3,9 @@
 #include "globals.h"
 #include "ComponentType.h"
 #include "GameObject.h"
+#include "ComponentManager.h"
+#include "Engine.h"
+#include "PoolAllocator.h"
 
 
 // TESTING START
@@ -22,6 +25,11 @@ Component::Component()
 
 Component::~Component()
 {
+	if (m_manager != nullptr)
+	{
+		m_manager->onComponentDestroyed(this);
+	}
+
 	// TESTING START
 	//OutputLog("DEBUG: Component  destructed -id: %i  ||  Alive: %i", m_id, --s_alive);
 	// TESTING END
@@ -42,7 +50,11 @@ Reference<GameObject>& Component::gameObject()
 
 void Component::setActive(bool activeState)
 {
-	m_isActive = activeState;
+	if (m_isActive != activeState)
+	{
+		m_isActive = activeState;
+		notifyActiveStateChanged();
+	}
 }
 
 
@@ -50,3 +62,31 @@ bool Component::isActive() const
 {
 	return m_isActive && gameObject()->isActive();
 }
+
+
+int Component::getTypeId() const
+{
+	return m_typeId;
+}
+
+
+void Component::notifyActiveStateChanged()
+{
+	// Lets the manager move this component between its active and inactive partitions
+	if (m_manager != nullptr)
+	{
+		m_manager->onComponentActiveStateChanged(this);
+	}
+}
+
+
+void* Component::operator new(size_t size)
+{
+	return engine->objectPools->allocate(size);
+}
+
+
+void Component::operator delete(void* ptr, size_t size)
+{
+	engine->objectPools->deallocate(ptr, size);
+}
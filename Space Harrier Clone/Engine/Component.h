@@ -1,8 +1,10 @@
 #ifndef H_COMPONENT
 #define H_COMPONENT
 
+#include <cstddef>
 #include "Reference.h"
 class GameObject;
+class ComponentManager;
 enum class ComponentType;
 
 
@@ -10,6 +12,7 @@ class Component
 {
 	friend class ComponentsManager;
 	friend class ComponentManager;
+	friend class GameObject;
 
 public:
 	virtual ~Component() = 0;
@@ -18,6 +21,13 @@ public:
 	Reference<GameObject>& gameObject();
 	void setActive(bool activeState);
 	bool isActive() const;
+	// Id of the concrete type of this Component (see TypeId)
+	int getTypeId() const;
+
+	// Components are allocated from the engine's object pools (see PoolAllocator)
+	// Note: the destructor is virtual, so the size received on delete is the one of the concrete type
+	static void* operator new(size_t size);
+	static void operator delete(void* ptr, size_t size);
 
 protected:
 	Component();
@@ -32,8 +42,15 @@ private:
 	int m_id;
 	// TESTING FIELDS END
 
+	void notifyActiveStateChanged();
+
 	Reference<GameObject> m_gameObject;
 	bool m_isActive;
+	int m_typeId = -1;
+
+	// ComponentManager this component is subscribed to, and its slot in the manager's list of components
+	ComponentManager* m_manager = nullptr;
+	int m_managerSlot = -1;
 };
 
 
@@ -1,7 +1,7 @@
 #include "ComponentManager.h"
 
 #include <algorithm>
-#include "EngineUtils.h"
+#include <functional>
 #include "Component.h"
 
 
@@ -12,14 +12,31 @@ ComponentManager::ComponentManager()
 
 ComponentManager::~ComponentManager()
 {
+	// Components that outlive the manager must not notify it when destroyed
+	for (Reference<Component>& component : m_components)
+	{
+		if (component)
+		{
+			setSubscribed(*component, false);
+			component->m_managerSlot = -1;
+		}
+	}
+	for (Reference<Component>& component : m_componentsToSubscribe)
+	{
+		if (component)
+		{
+			setSubscribed(*component, false);
+		}
+	}
 }
 
 
 bool ComponentManager::subscribeComponent(Reference<Component>& component)
 {
-	// If component is not already in the components-to-subscribe list, add it
-	if (managedComponentType() == component->m_type && EngineUtils::indexOf(m_componentsToSubscribe, component) == -1)
+	// If component is not already subscribed (or about to be), add it
+	if (managedComponentType() == component->m_type && !isSubscribed(*component))
 	{
+		setSubscribed(*component, true);
 		m_componentsToSubscribe.push_back(component);
 		initializeComponent(component);
 		return true;
@@ -30,10 +47,11 @@ bool ComponentManager::subscribeComponent(Reference<Component>& component)
 
 bool ComponentManager::unsubscribeComponent(Reference<Component>& component)
 {
-	// If component is not already in the components-to-unsubscribe list, add it
-	if (EngineUtils::indexOf(m_componentsToSubscribe, component) == -1)
+	// If component is in the components list, its slot will be released on the next refresh
+	if (component && isSubscribed(*component) && component->m_managerSlot != -1)
 	{
-		m_componentsToUnsubscribe.push_back(component);
+		setSubscribed(*component, false);
+		m_slotsToRemove.push_back(component->m_managerSlot);
 		return true;
 	}
 	return false;
@@ -49,52 +67,156 @@ void ComponentManager::close()
 
 void ComponentManager::refreshComponents()
 {
-	removeEmptyReferences();
-
-	// Unsubscribe components
-	for (Reference<Component>& component : m_componentsToUnsubscribe)
+	// Release the slots of unsubscribed and destroyed components
+	// Note: going from the highest slot down, the last component (which fills each released slot) is always one to keep
+	std::sort(m_slotsToRemove.begin(), m_slotsToRemove.end(), std::greater<int>());
+	for (int slot : m_slotsToRemove)
 	{
-		doUnsubscribe(component);
+		removeSlot(slot);
 	}
-	m_componentsToUnsubscribe.clear();
+	m_slotsToRemove.clear();
 
-	// Subscribe components
+	// Subscribe components (skipping the ones destroyed in the meantime)
 	for (Reference<Component>& component : m_componentsToSubscribe)
 	{
-		doSubscribe(component);
+		if (component)
+		{
+			doSubscribe(component);
+		}
 	}
 	m_componentsToSubscribe.clear();
+
+	// Move the components whose active state changed to the matching partition
+	for (Reference<Component>& component : m_componentsToRefreshActive)
+	{
+		if (component && isSubscribed(*component) && component->m_managerSlot != -1)
+		{
+			refreshActivePartition(component->m_managerSlot);
+		}
+	}
+	m_componentsToRefreshActive.clear();
+}
+
+
+void ComponentManager::doSubscribe(Reference<Component>& component)
+{
+	component->m_managerSlot = m_components.size();
+	m_components.push_back(component);
+	refreshActivePartition(component->m_managerSlot);
+}
+
+
+void ComponentManager::removeSlot(int slot)
+{
+	// The component may still be alive if it was unsubscribed
+	if (m_components[slot])
+	{
+		m_components[slot]->m_managerSlot = -1;
+	}
+
+	// Fill the slot with the last component instead of shifting all the following ones
+	// To keep the partitions contiguous, an active slot is filled with the last active component first
+	if (slot < m_activeCount)
+	{
+		int lastActiveSlot = m_activeCount - 1;
+		moveSlot(lastActiveSlot, slot);
+		slot = lastActiveSlot;
+		--m_activeCount;
+		m_hasActivePartitionChanged = true;
+	}
+	moveSlot(m_components.size() - 1, slot);
+	m_components.pop_back();
+}
+
+
+void ComponentManager::moveSlot(int fromSlot, int toSlot)
+{
+	if (fromSlot != toSlot)
+	{
+		m_components[toSlot] = m_components[fromSlot];
+		m_components[toSlot]->m_managerSlot = toSlot;
+	}
 }
 
 
-void ComponentManager::removeEmptyReferences()
+void ComponentManager::swapSlots(int slot1, int slot2)
 {
-	m_components.erase(std::remove_if(m_components.begin(), m_components.end(), [](Reference<Component>& component) -> bool {return !component; }), m_components.end());
+	if (slot1 != slot2)
+	{
+		Reference<Component> component1 = m_components[slot1];
+		m_components[slot1] = m_components[slot2];
+		m_components[slot2] = component1;
+		m_components[slot1]->m_managerSlot = slot1;
+		m_components[slot2]->m_managerSlot = slot2;
+	}
 }
 
 
-void ComponentManager::doSubscribe(const Reference<Component>& component)
+void ComponentManager::refreshActivePartition(int slot)
 {
-	// If component is not already in the components list, add it
-	if (EngineUtils::indexOf(m_components, component) == -1)
+	// Components cross the partitions' boundary by swapping with the component next to it
+	bool isActive = isComponentActive(*m_components[slot]);
+	if (isActive && slot >= m_activeCount)
 	{
-		m_components.push_back(component);
+		swapSlots(slot, m_activeCount);
+		++m_activeCount;
+		m_hasActivePartitionChanged = true;
+	}
+	else if (!isActive && slot < m_activeCount)
+	{
+		--m_activeCount;
+		swapSlots(slot, m_activeCount);
+		m_hasActivePartitionChanged = true;
 	}
 }
 
 
-void ComponentManager::doUnsubscribe(const Reference<Component>& component)
+void ComponentManager::sortActivePartition(bool(*compare)(const Reference<Component>&, const Reference<Component>&))
 {
-	// If component is in the components list, then remove it
-	int index = EngineUtils::indexOf(m_components, component);
-	if (index != -1)
+	std::stable_sort(m_components.begin(), m_components.begin() + m_activeCount, compare);
+	for (int i = 0; i < m_activeCount; ++i)
 	{
-		m_components.erase(m_components.begin() + index);
+		m_components[i]->m_managerSlot = i;
 	}
 }
 
 
+bool ComponentManager::isComponentActive(const Component& component) const
+{
+	return component.isActive();
+}
+
+
+void ComponentManager::onComponentDestroyed(Component* component)
+{
+	// Components still waiting to be subscribed are skipped by refreshComponents
+	if (component->m_managerSlot != -1)
+	{
+		m_slotsToRemove.push_back(component->m_managerSlot);
+	}
+}
+
+
+void ComponentManager::onComponentActiveStateChanged(Component* component)
+{
+	// Note: the actual state is checked when refreshing, so toggling a component more than once is harmless
+	m_componentsToRefreshActive.push_back(component->m_self);
+}
+
+
 ComponentType ComponentManager::getComponentType(const Reference<Component>& component) const
 {
 	return component->m_type;
 }
+
+
+bool ComponentManager::isSubscribed(const Component& component) const
+{
+	return component.m_manager == this;
+}
+
+
+void ComponentManager::setSubscribed(Component& component, bool subscribedState)
+{
+	component.m_manager = subscribedState ? this : nullptr;
+}
@@ -7,8 +7,13 @@ class Component;
 enum class ComponentType;
 
 
+// Keeps a dense list of its components, in which each component knows its own slot
+// The active components come first (in [0, m_activeCount)), so that per-tick loops can skip the inactive ones
+// Subscriptions, removals and active state changes are deferred, and applied in a batch by refreshComponents
 class ComponentManager
 {
+	friend class Component;
+
 public:
 	ComponentManager();
 	virtual ~ComponentManager();
@@ -24,14 +29,31 @@ public:
 
 protected:
 	void refreshComponents();
-	void removeEmptyReferences();
-	void doSubscribe(const Reference<Component>& component);
-	void doUnsubscribe(const Reference<Component>& component);
+	void doSubscribe(Reference<Component>& component);
+	void removeSlot(int slot);
+	void moveSlot(int fromSlot, int toSlot);
+	void swapSlots(int slot1, int slot2);
+	void refreshActivePartition(int slot);
+	// Stable sort of the active partition
+	void sortActivePartition(bool(*compare)(const Reference<Component>&, const Reference<Component>&));
+	// Whether component belongs in the active partition
+	virtual bool isComponentActive(const Component& component) const;
 	ComponentType getComponentType(const Reference<Component>& component) const;
+	bool isSubscribed(const Component& component) const;
+	void setSubscribed(Component& component, bool subscribedState);
 
 	std::vector<Reference<Component>> m_components;
 	std::vector<Reference<Component>> m_componentsToSubscribe;
-	std::vector<Reference<Component>> m_componentsToUnsubscribe;
+	std::vector<int> m_slotsToRemove;
+	int m_activeCount = 0;
+	// Set whenever a component joins, leaves or moves inside the active partition (cleared by the derived managers)
+	bool m_hasActivePartitionChanged = false;
+	std::vector<Reference<Component>> m_componentsToRefreshActive;
+
+	virtual void onComponentActiveStateChanged(Component* component);
+
+private:
+	virtual void onComponentDestroyed(Component* component);
 };
 
 
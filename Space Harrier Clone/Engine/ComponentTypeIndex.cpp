@@ -0,0 +1,91 @@
+#include "ComponentTypeIndex.h"
+
+#include <algorithm>
+
+
+void ComponentTypeIndex::onComponentAdded(const std::vector<ReferenceOwner<Component>>& components)
+{
+	// The new component is the last one, so it only matters for the types that had no match yet
+	int slot = components.size() - 1;
+	const Component& component = *components[slot];
+	for (unsigned int typeId = 0; typeId < m_slots.size(); ++typeId)
+	{
+		if (m_slots[typeId] == NOT_FOUND && isCastable(typeId, component))
+		{
+			m_slots[typeId] = slot;
+		}
+	}
+}
+
+
+void ComponentTypeIndex::onComponentsRemoved()
+{
+	// Slots have shifted, so every entry will be indexed again the next time it is looked up
+	std::fill(m_slots.begin(), m_slots.end(), NOT_INDEXED);
+}
+
+
+int ComponentTypeIndex::registerLookupType(int typeId, CastCheck castCheck)
+{
+	std::vector<CastCheck>& checks = castChecks();
+	if (typeId >= (int)checks.size())
+	{
+		checks.resize(typeId + 1, nullptr);
+	}
+	checks[typeId] = castCheck;
+	return typeId;
+}
+
+
+bool ComponentTypeIndex::isCastable(int typeId, const Component& component)
+{
+	std::vector<std::vector<char>>& results = castResults();
+	if (typeId >= (int)results.size())
+	{
+		results.resize(typeId + 1);
+	}
+	std::vector<char>& lookupTypeResults = results[typeId];
+	int concreteTypeId = component.getTypeId();
+	if (concreteTypeId < 0)
+	{
+		return castChecks()[typeId](component);
+	}
+	if (concreteTypeId >= (int)lookupTypeResults.size())
+	{
+		lookupTypeResults.resize(concreteTypeId + 1, 0);
+	}
+	if (lookupTypeResults[concreteTypeId] == 0)
+	{
+		lookupTypeResults[concreteTypeId] = castChecks()[typeId](component) ? 1 : 2;
+	}
+	return lookupTypeResults[concreteTypeId] == 1;
+}
+
+
+void ComponentTypeIndex::indexType(int typeId, const std::vector<ReferenceOwner<Component>>& components)
+{
+	m_slots[typeId] = NOT_FOUND;
+	for (unsigned int slot = 0; slot < components.size(); ++slot)
+	{
+		if (isCastable(typeId, *components[slot]))
+		{
+			m_slots[typeId] = slot;
+			return;
+		}
+	}
+}
+
+
+std::vector<ComponentTypeIndex::CastCheck>& ComponentTypeIndex::castChecks()
+{
+	// Function-local so that it is initialized before any type registers itself
+	static std::vector<CastCheck> s_castChecks;
+	return s_castChecks;
+}
+
+
+std::vector<std::vector<char>>& ComponentTypeIndex::castResults()
+{
+	static std::vector<std::vector<char>> s_castResults;
+	return s_castResults;
+}
@@ -0,0 +1,88 @@
+#ifndef H_COMPONENT_TYPE_INDEX
+#define H_COMPONENT_TYPE_INDEX
+
+#include <vector>
+#include "ReferenceOwner.h"
+#include "Component.h"
+#include "TypeId.h"
+
+
+// Index of the components of a GameObject by type (concrete or base class), filled in as components get added
+// Whether a concrete type can be casted to a looked up type is resolved only once per pair of types, so lookups don't use RTTI
+class ComponentTypeIndex final
+{
+public:
+	// Slot in components of the first component castable to T (-1 if there is none)
+	template<typename T>
+	int find(const std::vector<ReferenceOwner<Component>>& components);
+	template<typename T>
+	static bool isCastable(const Component& component);
+
+	void onComponentAdded(const std::vector<ReferenceOwner<Component>>& components);
+	void onComponentsRemoved();
+
+private:
+	typedef bool(*CastCheck)(const Component&);
+
+	// Slot values other than valid indices
+	static const int NOT_FOUND = -1;
+	static const int NOT_INDEXED = -2;
+
+	template<typename T>
+	static bool canCast(const Component& component);
+	template<typename T>
+	static int lookupTypeId();
+	static int registerLookupType(int typeId, CastCheck castCheck);
+	static bool isCastable(int typeId, const Component& component);
+
+	void indexType(int typeId, const std::vector<ReferenceOwner<Component>>& components);
+
+	// Shared by all GameObjects, indexed by type id
+	static std::vector<CastCheck>& castChecks();
+	// For each lookup type id, a cached cast result (0 unknown, 1 castable, 2 not castable) for each concrete type id
+	static std::vector<std::vector<char>>& castResults();
+
+	// First castable slot, indexed by lookup type id
+	std::vector<int> m_slots;
+};
+
+
+template<typename T>
+int ComponentTypeIndex::find(const std::vector<ReferenceOwner<Component>>& components)
+{
+	int typeId = lookupTypeId<T>();
+	if (typeId >= (int)m_slots.size())
+	{
+		m_slots.resize(typeId + 1, NOT_INDEXED);
+	}
+	if (m_slots[typeId] == NOT_INDEXED)
+	{
+		indexType(typeId, components);
+	}
+	return m_slots[typeId];
+}
+
+
+template<typename T>
+bool ComponentTypeIndex::isCastable(const Component& component)
+{
+	return isCastable(lookupTypeId<T>(), component);
+}
+
+
+template<typename T>
+bool ComponentTypeIndex::canCast(const Component& component)
+{
+	return dynamic_cast<const T*>(&component) != nullptr;
+}
+
+
+template<typename T>
+int ComponentTypeIndex::lookupTypeId()
+{
+	static const int id = registerLookupType(TypeId::of<T>(), &canCast<T>);
+	return id;
+}
+
+
+#endif // !H_COMPONENT_TYPE_INDEX
@@ -4,6 +4,9 @@
 #include "BehavioursManager.h"
 #include "CollidersManager.h"
 #include "RenderersManager.h"
+#include "ComponentType.h"
+#include "Engine.h"
+#include "FrameProfiler.h"
 
 
 ComponentsManager::ComponentsManager()
@@ -60,6 +63,44 @@ void ComponentsManager::update() const
 {
 	for (auto compManager : m_componentManagers)
 	{
-		compManager->update();
+		// Renderers keep where they start the tick from, to interpolate towards where they end it
+		if (compManager->managedComponentType() == ComponentType::RENDERER)
+		{
+			static_cast<RenderersManager*>(compManager)->storeTickStates();
+		}
+	}
+
+	for (auto compManager : m_componentManagers)
+	{
+		ComponentType type = compManager->managedComponentType();
+		if (type != ComponentType::RENDERER)
+		{
+			ScopedPhaseTimer timer(engine->profiler, type == ComponentType::BEHAVIOUR ? FramePhase::BEHAVIOURS : FramePhase::COLLIDERS);
+			compManager->update();
+		}
+	}
+}
+
+
+void ComponentsManager::render() const
+{
+	for (auto compManager : m_componentManagers)
+	{
+		if (compManager->managedComponentType() == ComponentType::RENDERER)
+		{
+			compManager->update();
+		}
+	}
+}
+
+
+void ComponentsManager::onRenderTargetsReset(bool isDeviceReset) const
+{
+	for (auto compManager : m_componentManagers)
+	{
+		if (compManager->managedComponentType() == ComponentType::RENDERER)
+		{
+			static_cast<RenderersManager*>(compManager)->resetLayerCaches(isDeviceReset);
+		}
 	}
 }
@@ -2,8 +2,12 @@
 #define H_COMPONENTS_MANAGER
 
 #include <vector>
+#include <type_traits>
 #include "Component.h"
+#include "Behaviour.h"
 #include "ReferenceOwner.h"
+#include "TypeId.h"
+#include "BehaviourTypeRegistry.h"
 class GameObject;
 class ComponentManager;
 
@@ -17,13 +21,22 @@ public:
 	bool init();
 	void close();
 
+	// Simulation tick (every ComponentManager but the RenderersManager)
 	void update() const;
+	// Frame rendering (the RenderersManager)
+	void render() const;
+	// The renderer lost the contents of its render targets (or, on a device reset, the textures themselves)
+	void onRenderTargetsReset(bool isDeviceReset) const;
 
 	template<typename T>
 	ReferenceOwner<T> createNew(Reference<GameObject>& goRef) const;
 
 private:
 	bool sendToManager(Reference<Component> component) const;
+	template<typename T>
+	static void detectUpdateOverride(T* component, std::true_type isBehaviour);
+	template<typename T>
+	static void detectUpdateOverride(T* component, std::false_type isBehaviour);
 
 	std::vector<ComponentManager*> m_componentManagers;
 };
@@ -48,6 +61,8 @@ ReferenceOwner<T> ComponentsManager::createNew(Reference<GameObject>& goRef) con
 			auto component = ReferenceOwner<T>(new T());
 			component->m_gameObject = goRef;
 			component->m_self = component;
+			component->m_typeId = TypeId::of<T>();
+			detectUpdateOverride(component.get(), std::is_base_of<Behaviour, T>());
 
 			if (typeid(T) != typeid(Transform) && !sendToManager(component.getStaticCastedReference<Component>()))
 			{
@@ -59,4 +74,23 @@ ReferenceOwner<T> ComponentsManager::createNew(Reference<GameObject>& goRef) con
 }
 
 
+template<typename T>
+void ComponentsManager::detectUpdateOverride(T* component, std::true_type /*isBehaviour*/)
+{
+	// If neither T nor any of its bases override update, &T::update is still a pointer to a member of Behaviour
+	bool overridesUpdate = !std::is_same<decltype(&T::update), void (Behaviour::*)()>::value;
+	static_cast<Behaviour*>(component)->m_overridesUpdate = overridesUpdate;
+	if (overridesUpdate)
+	{
+		BehaviourTypeRegistry::registerType<T>();
+	}
+}
+
+
+template<typename T>
+void ComponentsManager::detectUpdateOverride(T* /*component*/, std::false_type /*isBehaviour*/)
+{
+}
+
+
 #endif // !H_COMPONENTS_MANAGER
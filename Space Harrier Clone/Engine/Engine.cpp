@@ -15,6 +15,13 @@
 #include "PrefabsFactory.h"
 #include "GameObjectsManager.h"
 #include "ComponentsManager.h"
+#include "FrameProfiler.h"
+#include "FramePhase.h"
+#include "BehaviourProfiler.h"
+#include "JobSystem.h"
+#include "PoolAllocator.h"
+#include "AssetPack.h"
+#include "ResourceCache.h"
 
 
 
@@ -22,6 +29,11 @@ Engine* engine = nullptr;
 
 Engine::Engine()
 {
+	// Created first and deleted last, since every GameObject and Component is allocated from it
+	objectPools = new PoolAllocator();
+	// Deleted after the AudioController, since streamed music may still be reading from the pack
+	assetPack = new AssetPack();
+	resources = new ResourceCache();
 	time = new TimeController();
 	input = new InputController();
 	audio = new AudioController();
@@ -29,11 +41,20 @@ Engine::Engine()
 	prefabsFactory = new PrefabsFactory();
 	gameObjectsManager = new GameObjectsManager();
 	componentsManager = new ComponentsManager();
+	profiler = new FrameProfiler();
+	behaviourProfiler = new BehaviourProfiler();
+	jobSystem = new JobSystem();
 }
 
 
 Engine::~Engine()
 {
+	delete jobSystem;
+	jobSystem = nullptr;
+	delete behaviourProfiler;
+	behaviourProfiler = nullptr;
+	delete profiler;
+	profiler = nullptr;
 	delete componentsManager;
 	componentsManager = nullptr;
 	delete gameObjectsManager;
@@ -48,6 +69,12 @@ Engine::~Engine()
 	input = nullptr;
 	delete time;
 	time = nullptr;
+	delete resources;
+	resources = nullptr;
+	delete assetPack;
+	assetPack = nullptr;
+	delete objectPools;
+	objectPools = nullptr;
 }
 
 
@@ -56,24 +83,59 @@ bool Engine::init() const
 	// Initialization flag
 	bool success = true;
 
+	profiler->init(PROFILER_FRAMES_COUNT);
+	jobSystem->init(JOB_WORKERS_COUNT);
+
 	success &= initSDL();
 
 	if (success)
 	{
+		if (m_isHeadless)
+		{
+			time->setVirtual(true);
+			audio->setEnabled(false);
+		}
+		// The pack is mapped before anything gets loaded (when it is about to be rebuilt, the loose files are used instead)
+		if (!BUILD_ASSET_PACK && !assetPack->open(ASSET_PACK_PATH))
+		{
+			OutputLog("INFO: No asset pack at %s, assets will be loaded from their own files.", ASSET_PACK_PATH.c_str());
+		}
 		success &= initEngine();
 	}
 	return success;
 }
 
 
+void Engine::setHeadless(bool isHeadless, int ticksLimit)
+{
+	m_isHeadless = isHeadless;
+	m_headlessTicksLimit = ticksLimit > 0 ? ticksLimit : 0;
+}
+
+
+bool Engine::isHeadless() const
+{
+	return m_isHeadless;
+}
+
+
+void Engine::setStartScene(unsigned int sceneIndex)
+{
+	m_startSceneIndex = sceneIndex;
+}
+
+
+unsigned int Engine::getStartScene() const
+{
+	return m_startSceneIndex;
+}
+
+
 void Engine::handleEvents(bool& shouldQuit) const
 {
 	// Event handler
 	SDL_Event e;
 
-	// Clear Input states
-	input->clearStates();
-
 	while (SDL_PollEvent(&e))
 	{
 		// User requested quit
@@ -84,11 +146,29 @@ void Engine::handleEvents(bool& shouldQuit) const
 		else if (e.type == SDL_KEYDOWN && e.key.repeat == 0)
 		{
 			input->setKeyDown(e.key.keysym.scancode);
+
+			// Profiler hotkeys
+			if (e.key.keysym.scancode == PROFILER_OVERLAY_KEY)
+			{
+				profiler->toggleOverlay();
+			}
+			else if (e.key.keysym.scancode == PROFILER_DUMP_KEY)
+			{
+				profiler->dumpCSV(PROFILER_CSV_PATH);
+				behaviourProfiler->logReport(BEHAVIOUR_PROFILER_REPORT_COUNT);
+				objectPools->logReport();
+				resources->logReport();
+			}
 		}
 		else if (e.type == SDL_KEYUP && e.key.repeat == 0)
 		{
 			input->setKeyUp(e.key.keysym.scancode);
 		}
+		// The cached render layers must be composed again
+		else if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET)
+		{
+			componentsManager->onRenderTargetsReset(e.type == SDL_RENDER_DEVICE_RESET);
+		}
 	}
 }
 
@@ -98,30 +178,90 @@ void Engine::loop() const
 	// Main loop flag
 	bool quit = false;
 
+	int ticksCount = 0;
+	Uint32 loopStartTime = SDL_GetTicks();
+
 	// While application is running
 	while (!quit)
 	{
+		profiler->beginFrame();
+
 		time->updateTime();
 
-		handleEvents(quit);
+		// Events are handled every frame, even those that run no tick
+		{
+			ScopedPhaseTimer timer(profiler, FramePhase::EVENTS);
+			handleEvents(quit);
+		}
+
+		// Run as many fixed-length simulation ticks as the elapsed time allows (possibly none)
+		while (!quit && time->consumeTick())
+		{
+			{
+				ScopedPhaseTimer timer(profiler, FramePhase::EVENTS);
+				// Latch (and record or replay) this tick's input
+				input->refreshTick();
+			}
+
+			{
+				ScopedPhaseTimer timer(profiler, FramePhase::SCENES);
+				sceneManager->refreshScenes();
+			}
+
+			{
+				ScopedPhaseTimer timer(profiler, FramePhase::GAME_OBJECTS);
+				gameObjectsManager->update();
+			}
+
+			componentsManager->update();
+
+			++ticksCount;
+		}
+
+		componentsManager->render();
 
-		sceneManager->refreshScenes();
+		profiler->endFrame();
 
-		gameObjectsManager->update();
+		if (m_isHeadless && m_headlessTicksLimit > 0 && ticksCount >= m_headlessTicksLimit)
+		{
+			quit = true;
+		}
+		// A headless replay has nothing else to simulate once the recorded input is over
+		if (m_isHeadless && input->isReplayFinished())
+		{
+			quit = true;
+		}
+	}
 
-		componentsManager->update();
+	if (m_isHeadless)
+	{
+		Uint32 realTime = SDL_GetTicks() - loopStartTime;
+		OutputLog("INFO: Headless run simulated %i ticks (%u ms) in %u ms.", ticksCount, time->time(), realTime);
+		profiler->dumpCSV(PROFILER_CSV_PATH);
+		behaviourProfiler->logReport(BEHAVIOUR_PROFILER_REPORT_COUNT);
+		objectPools->logReport();
+		resources->logReport();
 	}
 }
 
 
 void Engine::close() const
 {
+	// Write the input recording (if any)
+	input->stopRecording();
+
 	// Unload scene
 	sceneManager->close();
 
+	// Free the resources still loaded (textures must go before their renderer, and audio before closing the device)
+	resources->clear();
+
 	// Delete all ComponentManagers
 	componentsManager->close();
 
+	// Join the job workers
+	jobSystem->close();
+
 	// Quit SDL subsystems
 	Mix_CloseAudio();
 	Mix_Quit();
@@ -135,6 +275,13 @@ bool Engine::initSDL() const
 	// Initialization flag
 	bool success = true;
 
+	// Headless runs use SDL's dummy drivers (no window is shown and no audio device is opened)
+	if (m_isHeadless)
+	{
+		SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+		SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+	}
+
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0)
 	{
 		OutputLog("ERROR: SDL could not initialize! SDL Error: %s", SDL_GetError());
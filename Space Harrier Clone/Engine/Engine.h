@@ -8,6 +8,12 @@ class SceneManager;
 class PrefabsFactory;
 class GameObjectsManager;
 class ComponentsManager;
+class FrameProfiler;
+class BehaviourProfiler;
+class JobSystem;
+class PoolAllocator;
+class AssetPack;
+class ResourceCache;
 
 
 class Engine final
@@ -21,6 +27,14 @@ public:
 	void loop() const;
 	void close() const;
 
+	// Headless mode: no window, no audio output and a virtual clock (one tick per loop, as fast as possible)
+	// Must be selected before init. A ticksLimit of 0 runs until quit
+	void setHeadless(bool isHeadless, int ticksLimit = 0);
+	bool isHeadless() const;
+	// Index of the scene loaded at startup (must be selected before init)
+	void setStartScene(unsigned int sceneIndex);
+	unsigned int getStartScene() const;
+
 	TimeController* time = nullptr;
 	InputController* input = nullptr;
 	AudioController* audio = nullptr;
@@ -28,10 +42,20 @@ public:
 	PrefabsFactory* prefabsFactory = nullptr;
 	GameObjectsManager* gameObjectsManager = nullptr;
 	ComponentsManager* componentsManager = nullptr;
+	FrameProfiler* profiler = nullptr;
+	BehaviourProfiler* behaviourProfiler = nullptr;
+	JobSystem* jobSystem = nullptr;
+	PoolAllocator* objectPools = nullptr;
+	AssetPack* assetPack = nullptr;
+	ResourceCache* resources = nullptr;
 
 private:
 	bool initSDL() const;
 	bool initEngine() const;
+
+	bool m_isHeadless = false;
+	int m_headlessTicksLimit = 0;
+	unsigned int m_startSceneIndex = 0;
 };
 
 extern Engine* engine;
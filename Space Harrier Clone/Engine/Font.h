@@ -4,12 +4,13 @@
 #include <string>
 #include <map>
 #include "PixelPosition.h"
+#include "AssetId.h"
 
 
 struct Font
 {
 public:
-	std::string path;
+	AssetPath path;
 	int characterWidth;
 	int characterHeight;
 	std::map<char, PixelPosition> charsTopLeftCorners;
@@ -0,0 +1,210 @@
+#include "FrameCapture.h"
+
+#include <stdio.h>
+#include "SDL2_image/include/SDL_image.h"
+#include "globals.h"
+#include "FrameCaptureFormat.h"
+
+
+namespace
+{
+	const Uint32 CAPTURE_PIXEL_FORMAT = SDL_PIXELFORMAT_ARGB8888;
+	const int CAPTURE_BYTES_PER_PIXEL = 4;
+}
+
+
+FrameCapture::FrameCapture()
+	: m_format(FrameCaptureFormat::RAW)
+	, m_failedWrites(0)
+{
+}
+
+
+FrameCapture::~FrameCapture()
+{
+	stop();
+}
+
+
+bool FrameCapture::start(const std::string& directory, FrameCaptureFormat format, int buffersCount, int width, int height)
+{
+	if (m_isCapturing)
+	{
+		OutputLog("WARNING: Frame capture has already been started!");
+		return false;
+	}
+	if (buffersCount <= 0 || width <= 0 || height <= 0)
+	{
+		OutputLog("ERROR: Invalid frame capture setup (buffers: %i, size: %ix%i)!", buffersCount, width, height);
+		return false;
+	}
+
+	m_directory = directory;
+	m_format = format;
+	m_width = width;
+	m_height = height;
+	m_pitch = width * CAPTURE_BYTES_PER_PIXEL;
+
+	// All the pixel memory is allocated up-front so capturing doesn't allocate per frame
+	m_buffers = std::vector<FrameBuffer>(buffersCount);
+	for (FrameBuffer& buffer : m_buffers)
+	{
+		buffer.pixels.resize(m_pitch * m_height);
+	}
+	m_nextBuffer = 0;
+	m_pendingBuffers.clear();
+	m_nextFrameIndex = 0;
+	m_capturedFrames = 0;
+	m_droppedFrames = 0;
+	m_failedWrites = 0;
+
+	m_shouldStop = false;
+	m_writer = std::thread(&FrameCapture::writerLoop, this);
+	m_isCapturing = true;
+
+	OutputLog("INFO: Frame capture started (%i buffers of %ix%i) into %s", buffersCount, width, height, m_directory.c_str());
+	return true;
+}
+
+
+void FrameCapture::stop()
+{
+	if (!m_isCapturing)
+	{
+		return;
+	}
+
+	// Let the writer thread flush every pending frame before joining it
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shouldStop = true;
+	}
+	m_condition.notify_one();
+	m_writer.join();
+	m_isCapturing = false;
+
+	OutputLog("INFO: Frame capture stopped. Captured: %i, dropped: %i, failed writes: %i", m_capturedFrames, m_droppedFrames, m_failedWrites.load());
+	m_buffers.clear();
+	m_pendingBuffers.clear();
+}
+
+
+bool FrameCapture::isCapturing() const
+{
+	return m_isCapturing;
+}
+
+
+void FrameCapture::captureFrame(SDL_Renderer* renderer)
+{
+	if (!m_isCapturing)
+	{
+		return;
+	}
+
+	int frameIndex = m_nextFrameIndex++;
+
+	// The ring is consumed in order, so if the next buffer is still waiting to be written the frame is dropped (never waited for)
+	FrameBuffer& buffer = m_buffers[m_nextBuffer];
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (buffer.state != BufferState::FREE)
+		{
+			++m_droppedFrames;
+			return;
+		}
+	}
+
+	if (SDL_RenderReadPixels(renderer, nullptr, CAPTURE_PIXEL_FORMAT, buffer.pixels.data(), m_pitch) != 0)
+	{
+		OutputLog("WARNING: Unable to read back frame %i! SDL Error: %s", frameIndex, SDL_GetError());
+		++m_droppedFrames;
+		return;
+	}
+	buffer.frameIndex = frameIndex;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		buffer.state = BufferState::PENDING;
+		m_pendingBuffers.push_back(m_nextBuffer);
+	}
+	m_condition.notify_one();
+
+	++m_capturedFrames;
+	m_nextBuffer = (m_nextBuffer + 1) % m_buffers.size();
+}
+
+
+int FrameCapture::getCapturedFramesCount() const
+{
+	return m_capturedFrames;
+}
+
+
+int FrameCapture::getDroppedFramesCount() const
+{
+	return m_droppedFrames;
+}
+
+
+void FrameCapture::writerLoop()
+{
+	while (true)
+	{
+		int bufferIndex = -1;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() -> bool { return m_shouldStop || !m_pendingBuffers.empty(); });
+			if (m_pendingBuffers.empty())
+			{
+				// So m_shouldStop is set and everything has been written
+				return;
+			}
+			bufferIndex = m_pendingBuffers.front();
+			m_pendingBuffers.pop_front();
+		}
+
+		// The buffer is owned by this thread until it is marked as free again
+		if (!writeFrame(m_buffers[bufferIndex]))
+		{
+			++m_failedWrites;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_buffers[bufferIndex].state = BufferState::FREE;
+		}
+	}
+}
+
+
+bool FrameCapture::writeFrame(const FrameBuffer& buffer) const
+{
+	char fileName[32];
+	snprintf(fileName, sizeof(fileName), "frame_%06i.%s", buffer.frameIndex, m_format == FrameCaptureFormat::PNG ? "png" : "raw");
+	std::string path = m_directory + fileName;
+
+	if (m_format == FrameCaptureFormat::PNG)
+	{
+		SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom((void*)buffer.pixels.data(), m_width, m_height, 32, m_pitch, CAPTURE_PIXEL_FORMAT);
+		if (surface == nullptr)
+		{
+			return false;
+		}
+		bool success = IMG_SavePNG(surface, path.c_str()) == 0;
+		SDL_FreeSurface(surface);
+		return success;
+	}
+	else
+	{
+		// Raw frames are the ARGB8888 pixels, row after row, with no header (the size is the window size)
+		SDL_RWops* file = SDL_RWFromFile(path.c_str(), "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+		size_t written = SDL_RWwrite(file, buffer.pixels.data(), 1, buffer.pixels.size());
+		SDL_RWclose(file);
+		return written == buffer.pixels.size();
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef H_FRAME_CAPTURE
+#define H_FRAME_CAPTURE
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "SDL2/include/SDL_render.h"
+enum class FrameCaptureFormat;
+
+
+class FrameCapture final
+{
+public:
+	FrameCapture();
+	~FrameCapture();
+
+	bool start(const std::string& directory, FrameCaptureFormat format, int buffersCount, int width, int height);
+	void stop();
+	bool isCapturing() const;
+
+	// Reads the current render target into a free buffer of the ring and hands it to the writer thread
+	void captureFrame(SDL_Renderer* renderer);
+
+	int getCapturedFramesCount() const;
+	int getDroppedFramesCount() const;
+
+private:
+	enum class BufferState
+	{
+		FREE,
+		PENDING
+	};
+
+	struct FrameBuffer
+	{
+		std::vector<Uint8> pixels;
+		int frameIndex = 0;
+		BufferState state = BufferState::FREE;
+	};
+
+	void writerLoop();
+	bool writeFrame(const FrameBuffer& buffer) const;
+
+	std::string m_directory;
+	FrameCaptureFormat m_format;
+	int m_width = 0;
+	int m_height = 0;
+	int m_pitch = 0;
+	bool m_isCapturing = false;
+
+	// Ring of pre-allocated buffers (only the buffer states and the queue are shared with the writer thread)
+	std::vector<FrameBuffer> m_buffers;
+	int m_nextBuffer = 0;
+	std::deque<int> m_pendingBuffers;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_writer;
+	bool m_shouldStop = false;
+
+	int m_nextFrameIndex = 0;
+	int m_capturedFrames = 0;
+	int m_droppedFrames = 0;
+	// Written from the writer thread (OutputLog is not thread safe, so failures are only counted there)
+	std::atomic<int> m_failedWrites;
+};
+
+
+#endif // !H_FRAME_CAPTURE
@@ -0,0 +1,12 @@
+#ifndef H_FRAME_CAPTURE_FORMAT
+#define H_FRAME_CAPTURE_FORMAT
+
+
+enum class FrameCaptureFormat
+{
+	RAW,
+	PNG
+};
+
+
+#endif // !H_FRAME_CAPTURE_FORMAT
@@ -0,0 +1,19 @@
+#ifndef H_FRAME_PHASE
+#define H_FRAME_PHASE
+
+
+enum class FramePhase
+{
+	EVENTS,
+	SCENES,
+	GAME_OBJECTS,
+	BEHAVIOURS,
+	COLLIDERS,
+	RENDERERS,
+	PRESENT,
+	FRAME,
+	COUNT
+};
+
+
+#endif // !H_FRAME_PHASE
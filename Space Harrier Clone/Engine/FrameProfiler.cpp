@@ -0,0 +1,194 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include "SDL2/include/SDL_timer.h"
+#include "SDL2/include/SDL_rwops.h"
+#include "globals.h"
+
+
+FrameProfiler::FrameProfiler()
+{
+	m_counterFrequency = SDL_GetPerformanceFrequency();
+	m_currentFrame = FrameSample();
+}
+
+
+FrameProfiler::~FrameProfiler()
+{
+}
+
+
+void FrameProfiler::init(int framesCount)
+{
+	if (framesCount <= 0)
+	{
+		OutputLog("WARNING: The requested profiler frames count (%i) is not a positive number. It will be set to 1.", framesCount);
+		framesCount = 1;
+	}
+	m_samples.assign(framesCount, FrameSample());
+	m_sortBuffer.reserve(framesCount);
+	m_nextSample = 0;
+	m_sampledFramesCount = 0;
+}
+
+
+void FrameProfiler::beginFrame()
+{
+	m_currentFrame = FrameSample();
+	m_frameStartCounter = SDL_GetPerformanceCounter();
+}
+
+
+void FrameProfiler::endFrame()
+{
+	addPhaseTime(FramePhase::FRAME, SDL_GetPerformanceCounter() - m_frameStartCounter);
+
+	if (m_samples.empty())
+	{
+		return;
+	}
+	m_samples[m_nextSample] = m_currentFrame;
+	m_nextSample = (m_nextSample + 1) % m_samples.size();
+	if (m_sampledFramesCount < (int)m_samples.size())
+	{
+		++m_sampledFramesCount;
+	}
+}
+
+
+void FrameProfiler::addPhaseTime(FramePhase phase, Uint64 counterTicks)
+{
+	m_currentFrame.times[(int)phase] += counterTicks * 1000.0f / m_counterFrequency;
+}
+
+
+float FrameProfiler::getCurrentTime(FramePhase phase) const
+{
+	if (m_sampledFramesCount == 0)
+	{
+		return 0;
+	}
+	int lastSample = (m_nextSample + m_samples.size() - 1) % m_samples.size();
+	return m_samples[lastSample].times[(int)phase];
+}
+
+
+float FrameProfiler::getPercentileTime(FramePhase phase, float percentile) const
+{
+	if (m_sampledFramesCount == 0)
+	{
+		return 0;
+	}
+
+	m_sortBuffer.clear();
+	for (int i = 0; i < m_sampledFramesCount; ++i)
+	{
+		m_sortBuffer.push_back(m_samples[i].times[(int)phase]);
+	}
+
+	// Nearest-rank percentile
+	int rank = (int)(percentile / 100.0f * (m_sampledFramesCount - 1) + 0.5f);
+	rank = std::min(std::max(rank, 0), m_sampledFramesCount - 1);
+	std::nth_element(m_sortBuffer.begin(), m_sortBuffer.begin() + rank, m_sortBuffer.end());
+	return m_sortBuffer[rank];
+}
+
+
+int FrameProfiler::getSampledFramesCount() const
+{
+	return m_sampledFramesCount;
+}
+
+
+bool FrameProfiler::dumpCSV(const std::string& path) const
+{
+	SDL_RWops* file = SDL_RWFromFile(path.c_str(), "w");
+	if (file == nullptr)
+	{
+		OutputLog("ERROR: Unable to open the profiler CSV file %s! SDL Error: %s", path.c_str(), SDL_GetError());
+		return false;
+	}
+
+	// Header
+	std::string line = "frame";
+	for (int phase = 0; phase < PHASES_COUNT; ++phase)
+	{
+		line += ",";
+		line += getPhaseName((FramePhase)phase);
+	}
+	line += "\n";
+	SDL_RWwrite(file, line.c_str(), 1, line.size());
+
+	// Samples, from the oldest to the newest (times in milliseconds)
+	char buffer[32];
+	int firstSample = m_sampledFramesCount < (int)m_samples.size() ? 0 : m_nextSample;
+	for (int i = 0; i < m_sampledFramesCount; ++i)
+	{
+		const FrameSample& sample = m_samples[(firstSample + i) % m_samples.size()];
+		SDL_snprintf(buffer, sizeof(buffer), "%i", i);
+		line = buffer;
+		for (int phase = 0; phase < PHASES_COUNT; ++phase)
+		{
+			SDL_snprintf(buffer, sizeof(buffer), ",%.4f", sample.times[phase]);
+			line += buffer;
+		}
+		line += "\n";
+		SDL_RWwrite(file, line.c_str(), 1, line.size());
+	}
+
+	SDL_RWclose(file);
+	OutputLog("INFO: Dumped %i profiled frames to %s.", m_sampledFramesCount, path.c_str());
+	return true;
+}
+
+
+bool FrameProfiler::isOverlayVisible() const
+{
+	return m_isOverlayVisible;
+}
+
+
+void FrameProfiler::toggleOverlay()
+{
+	m_isOverlayVisible = !m_isOverlayVisible;
+}
+
+
+const char* FrameProfiler::getPhaseName(FramePhase phase)
+{
+	switch (phase)
+	{
+	case FramePhase::EVENTS:
+		return "EVENTS";
+	case FramePhase::SCENES:
+		return "SCENES";
+	case FramePhase::GAME_OBJECTS:
+		return "OBJECTS";
+	case FramePhase::BEHAVIOURS:
+		return "BEHAVIOURS";
+	case FramePhase::COLLIDERS:
+		return "COLLIDERS";
+	case FramePhase::RENDERERS:
+		return "RENDERERS";
+	case FramePhase::PRESENT:
+		return "PRESENT";
+	case FramePhase::FRAME:
+		return "FRAME";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+
+ScopedPhaseTimer::ScopedPhaseTimer(FrameProfiler* profiler, FramePhase phase)
+	: m_profiler(profiler)
+	, m_phase(phase)
+	, m_startCounter(SDL_GetPerformanceCounter())
+{
+}
+
+
+ScopedPhaseTimer::~ScopedPhaseTimer()
+{
+	m_profiler->addPhaseTime(m_phase, SDL_GetPerformanceCounter() - m_startCounter);
+}
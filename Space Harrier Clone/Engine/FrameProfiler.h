@@ -0,0 +1,71 @@
+#ifndef H_FRAME_PROFILER
+#define H_FRAME_PROFILER
+
+#include <vector>
+#include <string>
+#include "SDL2/include/SDL_stdinc.h"
+#include "FramePhase.h"
+
+
+// Keeps the time spent in each phase of the last N frames (phases run several times in a frame add up)
+class FrameProfiler final
+{
+public:
+	FrameProfiler();
+	~FrameProfiler();
+
+	void init(int framesCount);
+
+	void beginFrame();
+	void endFrame();
+	void addPhaseTime(FramePhase phase, Uint64 counterTicks);
+
+	// Times in milliseconds
+	float getCurrentTime(FramePhase phase) const;
+	float getPercentileTime(FramePhase phase, float percentile) const;
+	int getSampledFramesCount() const;
+
+	bool dumpCSV(const std::string& path) const;
+
+	bool isOverlayVisible() const;
+	void toggleOverlay();
+
+	static const char* getPhaseName(FramePhase phase);
+
+private:
+	static const int PHASES_COUNT = (int)FramePhase::COUNT;
+
+	struct FrameSample
+	{
+		float times[PHASES_COUNT];
+	};
+
+	Uint64 m_counterFrequency = 0;
+	Uint64 m_frameStartCounter = 0;
+	FrameSample m_currentFrame;
+
+	// Ring buffer with the last frames (m_nextSample is the oldest one once the buffer is full)
+	std::vector<FrameSample> m_samples;
+	int m_nextSample = 0;
+	int m_sampledFramesCount = 0;
+
+	bool m_isOverlayVisible = false;
+	mutable std::vector<float> m_sortBuffer;
+};
+
+
+// Adds the time elapsed between its construction and its destruction to a phase of the current frame
+class ScopedPhaseTimer final
+{
+public:
+	ScopedPhaseTimer(FrameProfiler* profiler, FramePhase phase);
+	~ScopedPhaseTimer();
+
+private:
+	FrameProfiler* m_profiler;
+	FramePhase m_phase;
+	Uint64 m_startCounter;
+};
+
+
+#endif // !H_FRAME_PROFILER
@@ -6,6 +6,7 @@
 #include "Transform.h"
 #include "SceneManager.h"
 #include "GameObjectsManager.h"
+#include "PoolAllocator.h"
 #include "Transform.h"
 
 
@@ -22,7 +23,10 @@ GameObject::GameObject()
 	// TESTING END
 
 	m_isActive = true;
+	m_isActiveInHierarchy = true;
 	m_isInCreation = true;
+	m_slot = -1;
+	m_isPendingDestroy = false;
 }
 
 
@@ -70,6 +74,7 @@ void GameObject::doAddComponent(ReferenceOwner<Component>& component)
 {
 	// No need to check for components's presence in m_components since this funciton gets called with newly instantiated components only
 	m_components.push_back(std::move(component));
+	m_componentsIndex.onComponentAdded(m_components);
 }
 
 
@@ -80,24 +85,49 @@ void GameObject::doRemoveComponent(Reference<Component>& component)
 	if (componentIndex != -1)
 	{
 		m_components.erase(m_components.begin() + componentIndex);
+		m_componentsIndex.onComponentsRemoved();
 	}
 }
 
 
 void GameObject::setActive(bool activeState)
 {
-	m_isActive = activeState;
+	if (m_isActive != activeState)
+	{
+		m_isActive = activeState;
+		refreshActiveInHierarchy();
+	}
 }
 
 
 bool GameObject::isActive() const
 {
-	const Reference<Transform>& parent = transform->getParent();
-	if (parent)
+	return m_isActiveInHierarchy;
+}
+
+
+void GameObject::refreshActiveInHierarchy()
+{
+	bool activeInHierarchy = m_isActive;
+	Transform* parentTransform = transform->m_parentTransform;
+	if (parentTransform != nullptr)
+	{
+		activeInHierarchy = activeInHierarchy && parentTransform->gameObject()->m_isActiveInHierarchy;
+	}
+
+	// Only push the state down to the children if it actually changed
+	if (activeInHierarchy != m_isActiveInHierarchy)
 	{
-		return m_isActive && parent->gameObject()->isActive();
+		m_isActiveInHierarchy = activeInHierarchy;
+		for (ReferenceOwner<Component>& component : m_components)
+		{
+			component->notifyActiveStateChanged();
+		}
+		for (Transform* childTransform : transform->m_children)
+		{
+			childTransform->gameObject()->refreshActiveInHierarchy();
+		}
 	}
-	return m_isActive;
 }
 
 
@@ -123,3 +153,15 @@ void GameObject::destroy(Reference<GameObject>& gameObject)
 {
 	engine->gameObjectsManager->destroyGameObject(gameObject);
 }
+
+
+void* GameObject::operator new(size_t size)
+{
+	return engine->objectPools->allocate(size);
+}
+
+
+void GameObject::operator delete(void* ptr, size_t size)
+{
+	engine->objectPools->deallocate(ptr, size);
+}
@@ -8,12 +8,14 @@
 #include "Engine.h"
 #include "ReferenceOwner.h"
 #include "ComponentsManager.h"
+#include "ComponentTypeIndex.h"
 #include "Transform.h"
 
 
 class GameObject final
 {
 	friend class GameObjectsManager;
+	friend class Transform;
 
 public:
 	~GameObject();
@@ -42,6 +44,9 @@ public:
 	// Creation and destruction related
 	static Reference<GameObject> createNew();
 	static void destroy(Reference<GameObject>& gameObject);
+	// GameObjects are allocated from the engine's object pools (see PoolAllocator)
+	static void* operator new(size_t size);
+	static void operator delete(void* ptr, size_t size);
 
 	Reference<Transform> transform;
 
@@ -60,15 +65,23 @@ private:
 	void doAddComponent(ReferenceOwner<Component>& component);
 	void doRemoveComponent(Reference<Component>& component);
 	void refreshComponents();
+	void refreshActiveInHierarchy();
 
 	bool m_isActive;
+	// Cached m_isActive of this gameObject and all of its parents (pushed down to the children whenever it changes)
+	bool m_isActiveInHierarchy;
 	bool m_isInCreation;
 	Reference<GameObject> m_self;
 
+	// GameObjectsManager bookkeeping
+	int m_slot;	// Index in the manager's list of gameObjects (-1 while not added)
+	bool m_isPendingDestroy;
+
 	// Components related
 	std::vector<ReferenceOwner<Component>> m_components;
 	std::vector<ReferenceOwner<Component>> m_componentsToAdd;
 	std::vector<Reference<Component>> m_componentsToRemove;
+	mutable ComponentTypeIndex m_componentsIndex;
 };
 
 
@@ -82,6 +95,7 @@ Reference<T> GameObject::addComponent()
 		if (m_isInCreation)
 		{
 			m_components.push_back(std::move(component));
+			m_componentsIndex.onComponentAdded(m_components);
 		}
 		else
 		{
@@ -107,12 +121,10 @@ Reference<T> GameObject::getComponent() const
 	}
 	else
 	{
-		for (const ReferenceOwner<Component>& component : m_components)
+		int slot = m_componentsIndex.find<T>(m_components);
+		if (slot != -1)
 		{
-			if (component.is_castable_as<T>())
-			{
-				return component.getStaticCastedReference<T>();
-			}
+			return m_components[slot].getStaticCastedReference<T>();
 		}
 	}
 	return Reference<T>();
@@ -131,7 +143,7 @@ std::vector<Reference<T>> GameObject::getComponents() const
 	{
 		for (const ReferenceOwner<Component>& component : m_components)
 		{
-			if (component.is_castable_as<T>())
+			if (ComponentTypeIndex::isCastable<T>(*component))
 			{
 				referencesVector.push_back(component.getStaticCastedReference<T>());
 			}
@@ -150,12 +162,10 @@ Reference<T> GameObject::getComponentInChildren() const
 	}
 	else
 	{
-		for (const ReferenceOwner<Component>& component : m_components)
+		int slot = m_componentsIndex.find<T>(m_components);
+		if (slot != -1)
 		{
-			if (component.is_castable_as<T>())
-			{
-				return component.getStaticCastedReference<T>();
-			}
+			return m_components[slot].getStaticCastedReference<T>();
 		}
 
 		for (const Reference<Transform>& childTransformRef : transform->getChildren())
@@ -183,7 +193,7 @@ std::vector<Reference<T>> GameObject::getComponentsInChildren() const
 	{
 		for (const ReferenceOwner<Component>& component : m_components)
 		{
-			if (component.is_castable_as<T>())
+			if (ComponentTypeIndex::isCastable<T>(*component))
 			{
 				referencesVector.push_back(component.getStaticCastedReference<T>());
 			}
@@ -211,12 +221,10 @@ Reference<T> GameObject::getComponentInParent() const
 	}
 	else
 	{
-		for (const ReferenceOwner<Component>& component : m_components)
+		int slot = m_componentsIndex.find<T>(m_components);
+		if (slot != -1)
 		{
-			if (component.is_castable_as<T>())
-			{
-				return component.getStaticCastedReference<T>();
-			}
+			return m_components[slot].getStaticCastedReference<T>();
 		}
 		
 		const Reference<Transform>& parentTransform = transform->getParent();
@@ -245,7 +253,7 @@ template<typename T>
 	 {
 		 for (const ReferenceOwner<Component>& component : m_components)
 		 {
-			 if (component.is_castable_as<T>())
+			 if (ComponentTypeIndex::isCastable<T>(*component))
 			 {
 				 referencesVector.push_back(component.getStaticCastedReference<T>());
 			 }
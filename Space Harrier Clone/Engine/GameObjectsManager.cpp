@@ -1,6 +1,5 @@
 #include "GameObjectsManager.h"
 
-#include "EngineUtils.h"
 #include "GameObject.h"
 #include "Transform.h"
 #include "Behaviour.h"
@@ -24,21 +23,22 @@ void GameObjectsManager::update()
 
 void GameObjectsManager::addGameObject(ReferenceOwner<GameObject>& gameObject)
 {
-	// Check if the gameObject hasn't already been added to the list
-	if (EngineUtils::indexOf(m_gosToAdd, gameObject) == -1) {
+	// Note: gameObject is the only owner, so it can't already be in the list
+	if (gameObject) {
 		m_gosToAdd.push_back(std::move(gameObject));
-	}	
+	}
 }
 
 
 void GameObjectsManager::destroyGameObject(Reference<GameObject>& gameObject)
 {
 	// Check if the gameObject hasn't already been added to the list
-	if (EngineUtils::indexOf(m_gosToDestroy, gameObject) == -1) {
+	if (gameObject && !gameObject->m_isPendingDestroy) {
 		for (Reference<Behaviour>& behaviour : gameObject->getComponents<Behaviour>())
 		{
 			behaviour->onDestroy();
 		}
+		gameObject->m_isPendingDestroy = true;
 		m_gosToDestroy.push_back(gameObject);
 	}
 }
@@ -81,9 +81,10 @@ void GameObjectsManager::refreshGameObjects()
 
 void GameObjectsManager::doAddGameObject(ReferenceOwner<GameObject>& gameObject)
 {
-	if (EngineUtils::indexOf(m_gameObjects, gameObject) == -1) {
+	if (gameObject->m_slot == -1) {
 		// So the gameObject hasn't previously been added
 		gameObject->m_isInCreation = false;
+		gameObject->m_slot = m_gameObjects.size();
 		m_gameObjects.push_back(std::move(gameObject));
 	}
 }
@@ -93,18 +94,19 @@ void GameObjectsManager::doDestroyGameObject(Reference<GameObject>& gameObject)
 {
 	if (gameObject)
 	{
-		int index = EngineUtils::indexOf(m_gameObjects, gameObject);
-		if (index != -1) {
+		if (gameObject->m_slot != -1) {
 			// So, the gameObject is in the gameObjects vector
 			// Remove from parent
 			gameObject->transform->removeParent();
 			// Destroy children first
 			doDestroyChildren(gameObject->transform.get());
-			// Now find the updated index, since destroying the children has modified the actual index
-			int newIndex = EngineUtils::indexOf(m_gameObjects, gameObject);
-			/*ReferenceOwner<GameObject> goOwner = std::move(m_gameObjects[newIndex]);
-			goOwner.deleteReferences();*/
-			m_gameObjects.erase(m_gameObjects.begin() + newIndex);
+			// Note: destroying the children may have moved this gameObject to another slot
+			removeFromSlot(gameObject->m_slot);
+		}
+		else
+		{
+			// Not added yet, so it can be destroyed again later on
+			gameObject->m_isPendingDestroy = false;
 		}
 	}
 }
@@ -115,11 +117,27 @@ void GameObjectsManager::doDestroyChildren(Transform* parentTransform)
 	for (Transform* childTransform : parentTransform->m_children)
 	{
 		doDestroyChildren(childTransform);
-		int index = EngineUtils::indexOf(m_gameObjects, childTransform->gameObject());
-		if (index != -1) {
+		int slot = childTransform->gameObject()->m_slot;
+		if (slot != -1) {
 			// So, the gameObject is in the gameObjects vector
-			m_gameObjects.erase(m_gameObjects.begin() + index);
+			removeFromSlot(slot);
 		}
 	}
+}
 
+
+void GameObjectsManager::removeFromSlot(int slot)
+{
+	// Take the owner out first, so that the gameObject is deleted once the vector is consistent again
+	ReferenceOwner<GameObject> removedGo = std::move(m_gameObjects[slot]);
+	removedGo->m_slot = -1;
+
+	// Fill the slot with the last gameObject instead of shifting all the following ones
+	int lastSlot = m_gameObjects.size() - 1;
+	if (slot != lastSlot)
+	{
+		m_gameObjects[slot] = std::move(m_gameObjects[lastSlot]);
+		m_gameObjects[slot]->m_slot = slot;
+	}
+	m_gameObjects.pop_back();
 }
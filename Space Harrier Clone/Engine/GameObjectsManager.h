@@ -23,7 +23,9 @@ private:
 	void doAddGameObject(ReferenceOwner<GameObject>& gameObject);
 	void doDestroyGameObject(Reference<GameObject>& gameObject);
 	void doDestroyChildren(Transform* transform);
+	void removeFromSlot(int slot);
 
+	// Unordered: removals move the last gameObject into the freed slot (see GameObject::m_slot)
 	std::vector<ReferenceOwner<GameObject>> m_gameObjects;
 	std::vector<ReferenceOwner<GameObject>> m_gosToAdd;
 	std::vector<Reference<GameObject>> m_gosToDestroy;
@@ -1,6 +1,7 @@
 #include "InputController.h"
 
 #include "SDL2/include/SDL_keyboard.h"
+#include "globals.h"
 
 
 InputController::InputController()
@@ -17,12 +18,28 @@ InputController::~InputController()
 
 bool InputController::getKey(SDL_Scancode scancode) const
 {
+	if (m_isReplaying)
+	{
+		int index = recordedKeyIndex(scancode);
+		if (index != -1)
+		{
+			return (m_replayTickState.heldKeys & (1u << index)) != 0;
+		}
+	}
 	return m_currentKeyStates[scancode];
 }
 
 
 bool InputController::getKeyUp(SDL_Scancode scancode) const
 {
+	if (m_isReplaying)
+	{
+		int index = recordedKeyIndex(scancode);
+		if (index != -1)
+		{
+			return (m_replayTickState.upKeys & (1u << index)) != 0;
+		}
+	}
 	if (m_keyUpDownStates.count(scancode))
 	{
 		return m_keyUpDownStates.at(scancode) == KeyState::UP;
@@ -33,6 +50,14 @@ bool InputController::getKeyUp(SDL_Scancode scancode) const
 
 bool InputController::getKeyDown(SDL_Scancode scancode) const
 {
+	if (m_isReplaying)
+	{
+		int index = recordedKeyIndex(scancode);
+		if (index != -1)
+		{
+			return (m_replayTickState.downKeys & (1u << index)) != 0;
+		}
+	}
 	if (m_keyUpDownStates.count(scancode))
 	{
 		return m_keyUpDownStates.at(scancode) == KeyState::DOWN;
@@ -41,19 +66,146 @@ bool InputController::getKeyDown(SDL_Scancode scancode) const
 }
 
 
-void InputController::clearStates()
+void InputController::setKeyUp(SDL_Scancode scancode)
 {
-	m_keyUpDownStates.clear();
+	m_pendingKeyUpDownStates[scancode] = KeyState::UP;
 }
 
 
-void InputController::setKeyUp(SDL_Scancode scancode)
+void InputController::setKeyDown(SDL_Scancode scancode)
 {
-	m_keyUpDownStates[scancode] = KeyState::UP;
+	m_pendingKeyUpDownStates[scancode] = KeyState::DOWN;
 }
 
 
-void InputController::setKeyDown(SDL_Scancode scancode)
+void InputController::refreshTick()
 {
-	m_keyUpDownStates[scancode] = KeyState::DOWN;
+	m_keyUpDownStates.swap(m_pendingKeyUpDownStates);
+	m_pendingKeyUpDownStates.clear();
+
+	if (m_isRecording)
+	{
+		InputTickState tickState;
+		const std::vector<SDL_Scancode>& keys = m_recording.getKeys();
+		for (unsigned int i = 0; i < keys.size(); ++i)
+		{
+			if (m_currentKeyStates[keys[i]])
+			{
+				tickState.heldKeys |= 1u << i;
+			}
+			auto it = m_keyUpDownStates.find(keys[i]);
+			if (it != m_keyUpDownStates.end())
+			{
+				if (it->second == KeyState::DOWN)
+				{
+					tickState.downKeys |= 1u << i;
+				}
+				else
+				{
+					tickState.upKeys |= 1u << i;
+				}
+			}
+		}
+		m_recording.append(tickState);
+	}
+	else if (m_isReplaying)
+	{
+		if (!m_recording.next(m_replayTickState))
+		{
+			OutputLog("INFO: The input replay has finished. Live input will be used from now on.");
+			m_isReplaying = false;
+			m_isReplayFinished = true;
+		}
+	}
+}
+
+
+bool InputController::startRecording(const std::string& path, const std::vector<SDL_Scancode>& keys, Uint32 tickRate)
+{
+	if (m_isRecording || m_isReplaying)
+	{
+		OutputLog("WARNING: Input cannot be recorded while another recording or replay is in progress!");
+		return false;
+	}
+	m_recording.reset(keys, tickRate);
+	m_recordingPath = path;
+	m_isRecording = true;
+	return true;
+}
+
+
+bool InputController::stopRecording()
+{
+	if (!m_isRecording)
+	{
+		return false;
+	}
+	m_isRecording = false;
+	bool success = m_recording.save(m_recordingPath);
+	if (success)
+	{
+		OutputLog("INFO: Recorded %i ticks of input to %s.", m_recording.getTicksCount(), m_recordingPath.c_str());
+	}
+	return success;
+}
+
+
+bool InputController::isRecording() const
+{
+	return m_isRecording;
+}
+
+
+bool InputController::startReplay(const std::string& path, Uint32 tickRate)
+{
+	if (m_isRecording || m_isReplaying)
+	{
+		OutputLog("WARNING: Input cannot be replayed while another recording or replay is in progress!");
+		return false;
+	}
+	if (!m_recording.load(path))
+	{
+		return false;
+	}
+	if (m_recording.getTickRate() != tickRate)
+	{
+		// Ticks are replayed one by one, so a different tick rate changes the timing of the whole session
+		OutputLog("WARNING: The input recording %s was made at %u ticks per second, but the simulation runs %u ticks per second. The replay will diverge!", path.c_str(), m_recording.getTickRate(), tickRate);
+	}
+	m_replayTickState = InputTickState();
+	m_isReplaying = true;
+	m_isReplayFinished = false;
+	return true;
+}
+
+
+void InputController::stopReplay()
+{
+	m_isReplaying = false;
+}
+
+
+bool InputController::isReplaying() const
+{
+	return m_isReplaying;
+}
+
+
+bool InputController::isReplayFinished() const
+{
+	return m_isReplayFinished;
+}
+
+
+int InputController::recordedKeyIndex(SDL_Scancode scancode) const
+{
+	const std::vector<SDL_Scancode>& keys = m_recording.getKeys();
+	for (unsigned int i = 0; i < keys.size(); ++i)
+	{
+		if (keys[i] == scancode)
+		{
+			return i;
+		}
+	}
+	return -1;
 }
@@ -2,8 +2,11 @@
 #define H_INPUT_CONTROLLER
 
 #include <map>
+#include <string>
+#include <vector>
 #include "SDL2/include/SDL_stdinc.h"
 #include "SDL2/include/SDL_scancode.h"
+#include "InputRecording.h"
 
 
 class InputController final
@@ -16,9 +19,23 @@ public:
 	bool getKeyUp(SDL_Scancode scancode) const;
 	bool getKeyDown(SDL_Scancode scancode) const;
 
-	void clearStates();
+	// Key ups and downs are received once per frame, and kept until the next tick
 	void setKeyUp(SDL_Scancode scancode);
 	void setKeyDown(SDL_Scancode scancode);
+	// Called once per tick: the key ups and downs received since the previous tick become this tick's,
+	// and the tick's key states are recorded or replayed
+	void refreshTick();
+
+	// Recording (the states of the given keys are stored per tick and written to disk on stopRecording)
+	bool startRecording(const std::string& path, const std::vector<SDL_Scancode>& keys, Uint32 tickRate);
+	bool stopRecording();
+	bool isRecording() const;
+
+	// Replay (while replaying, the recorded keys report the recorded states instead of the live ones)
+	bool startReplay(const std::string& path, Uint32 tickRate);
+	void stopReplay();
+	bool isReplaying() const;
+	bool isReplayFinished() const;
 
 private:
 	enum class KeyState {
@@ -26,8 +43,18 @@ private:
 		DOWN
 	};
 
+	int recordedKeyIndex(SDL_Scancode scancode) const;
+
 	const Uint8* m_currentKeyStates = 0;
 	std::map<SDL_Scancode, KeyState> m_keyUpDownStates;
+	std::map<SDL_Scancode, KeyState> m_pendingKeyUpDownStates;
+
+	InputRecording m_recording;
+	std::string m_recordingPath;
+	bool m_isRecording = false;
+	bool m_isReplaying = false;
+	bool m_isReplayFinished = false;
+	InputTickState m_replayTickState;
 };
 
 
@@ -0,0 +1,196 @@
+#include "InputRecording.h"
+
+#include "SDL2/include/SDL_rwops.h"
+#include "globals.h"
+
+// File identifier ("SHIR") and format version
+static const Uint32 INPUT_RECORDING_MAGIC = 0x52494853;
+// Version 2 stores the tick rate (version 1 stored the rounded tick duration, in ms)
+static const Uint32 INPUT_RECORDING_VERSION = 2;
+
+
+InputRecording::InputRecording()
+{
+}
+
+
+InputRecording::~InputRecording()
+{
+}
+
+
+void InputRecording::reset(const std::vector<SDL_Scancode>& keys, Uint32 tickRate)
+{
+	m_keys = keys;
+	if (m_keys.size() > MAX_KEYS)
+	{
+		OutputLog("WARNING: Only the first %i of the %i keys requested will be recorded!", MAX_KEYS, m_keys.size());
+		m_keys.resize(MAX_KEYS);
+	}
+	m_tickRate = tickRate;
+	m_runs.clear();
+	m_runIndex = 0;
+	m_runTick = 0;
+}
+
+
+const std::vector<SDL_Scancode>& InputRecording::getKeys() const
+{
+	return m_keys;
+}
+
+
+Uint32 InputRecording::getTickRate() const
+{
+	return m_tickRate;
+}
+
+
+int InputRecording::getTicksCount() const
+{
+	int ticksCount = 0;
+	for (const InputRun& run : m_runs)
+	{
+		ticksCount += run.length;
+	}
+	return ticksCount;
+}
+
+
+void InputRecording::append(const InputTickState& tickState)
+{
+	if (!m_runs.empty())
+	{
+		InputTickState& last = m_runs.back().tickState;
+		if (last.heldKeys == tickState.heldKeys && last.downKeys == tickState.downKeys && last.upKeys == tickState.upKeys)
+		{
+			++m_runs.back().length;
+			return;
+		}
+	}
+	m_runs.push_back(InputRun{ 1, tickState });
+}
+
+
+bool InputRecording::save(const std::string& path) const
+{
+	SDL_RWops* file = SDL_RWFromFile(path.c_str(), "wb");
+	if (file == nullptr)
+	{
+		OutputLog("ERROR: Unable to open the input recording file %s! SDL Error: %s", path.c_str(), SDL_GetError());
+		return false;
+	}
+
+	// Header
+	bool success = true;
+	success &= SDL_WriteLE32(file, INPUT_RECORDING_MAGIC) == 1;
+	success &= SDL_WriteLE32(file, INPUT_RECORDING_VERSION) == 1;
+	success &= SDL_WriteLE32(file, m_tickRate) == 1;
+	success &= SDL_WriteLE32(file, m_keys.size()) == 1;
+	for (SDL_Scancode key : m_keys)
+	{
+		success &= SDL_WriteLE32(file, key) == 1;
+	}
+
+	// Runs
+	success &= SDL_WriteLE32(file, m_runs.size()) == 1;
+	for (const InputRun& run : m_runs)
+	{
+		success &= SDL_WriteLE32(file, run.length) == 1;
+		success &= SDL_WriteLE32(file, run.tickState.heldKeys) == 1;
+		success &= SDL_WriteLE32(file, run.tickState.downKeys) == 1;
+		success &= SDL_WriteLE32(file, run.tickState.upKeys) == 1;
+	}
+
+	SDL_RWclose(file);
+	if (!success)
+	{
+		OutputLog("ERROR: Unable to write the input recording file %s! SDL Error: %s", path.c_str(), SDL_GetError());
+	}
+	return success;
+}
+
+
+bool InputRecording::load(const std::string& path)
+{
+	SDL_RWops* file = SDL_RWFromFile(path.c_str(), "rb");
+	if (file == nullptr)
+	{
+		OutputLog("ERROR: Unable to open the input recording file %s! SDL Error: %s", path.c_str(), SDL_GetError());
+		return false;
+	}
+
+	bool success = true;
+	if (SDL_ReadLE32(file) != INPUT_RECORDING_MAGIC || SDL_ReadLE32(file) != INPUT_RECORDING_VERSION)
+	{
+		OutputLog("ERROR: The file %s is not a valid input recording!", path.c_str());
+		success = false;
+	}
+	else
+	{
+		Uint32 tickRate = SDL_ReadLE32(file);
+		Uint32 keysCount = SDL_ReadLE32(file);
+		if (keysCount > MAX_KEYS)
+		{
+			OutputLog("ERROR: The input recording %s has too many keys (%u)!", path.c_str(), keysCount);
+			success = false;
+		}
+		else
+		{
+			std::vector<SDL_Scancode> keys;
+			for (Uint32 i = 0; i < keysCount; ++i)
+			{
+				keys.push_back((SDL_Scancode)SDL_ReadLE32(file));
+			}
+			reset(keys, tickRate);
+
+			Uint32 runsCount = SDL_ReadLE32(file);
+			m_runs.reserve(runsCount);
+			for (Uint32 i = 0; i < runsCount; ++i)
+			{
+				InputRun run;
+				run.length = SDL_ReadLE32(file);
+				run.tickState.heldKeys = SDL_ReadLE32(file);
+				run.tickState.downKeys = SDL_ReadLE32(file);
+				run.tickState.upKeys = SDL_ReadLE32(file);
+				if (run.length == 0)
+				{
+					OutputLog("ERROR: The input recording %s is truncated or corrupted!", path.c_str());
+					success = false;
+					break;
+				}
+				m_runs.push_back(run);
+			}
+		}
+	}
+
+	SDL_RWclose(file);
+	if (!success)
+	{
+		m_runs.clear();
+	}
+	return success;
+}
+
+
+bool InputRecording::next(InputTickState& tickState)
+{
+	if (isFinished())
+	{
+		return false;
+	}
+
+	tickState = m_runs[m_runIndex].tickState;
+	if (++m_runTick >= m_runs[m_runIndex].length)
+	{
+		++m_runIndex;
+		m_runTick = 0;
+	}
+	return true;
+}
+
+
+bool InputRecording::isFinished() const
+{
+	return m_runIndex >= m_runs.size();
+}
@@ -0,0 +1,59 @@
+#ifndef H_INPUT_RECORDING
+#define H_INPUT_RECORDING
+
+#include <vector>
+#include <string>
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_scancode.h"
+
+
+// State of the recorded keys during one simulation tick (bit i refers to the i-th recorded key)
+struct InputTickState
+{
+	Uint32 heldKeys = 0;
+	Uint32 downKeys = 0;
+	Uint32 upKeys = 0;
+};
+
+
+// Per-tick key states of a session, run-length encoded (consecutive identical ticks are stored once)
+class InputRecording final
+{
+public:
+	static const int MAX_KEYS = 32;
+
+	InputRecording();
+	~InputRecording();
+
+	void reset(const std::vector<SDL_Scancode>& keys, Uint32 tickRate);
+	const std::vector<SDL_Scancode>& getKeys() const;
+	Uint32 getTickRate() const;
+	int getTicksCount() const;
+
+	// Recording
+	void append(const InputTickState& tickState);
+	bool save(const std::string& path) const;
+
+	// Replay
+	bool load(const std::string& path);
+	bool next(InputTickState& tickState);
+	bool isFinished() const;
+
+private:
+	struct InputRun
+	{
+		Uint32 length;
+		InputTickState tickState;
+	};
+
+	std::vector<SDL_Scancode> m_keys;
+	Uint32 m_tickRate = 0;
+	std::vector<InputRun> m_runs;
+
+	// Replay cursor
+	unsigned int m_runIndex = 0;
+	Uint32 m_runTick = 0;
+};
+
+
+#endif // !H_INPUT_RECORDING
@@ -0,0 +1,244 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include "globals.h"
+
+
+namespace
+{
+	// Chunks per thread: some slack for the faster threads to steal from the slower ones
+	const int CHUNKS_PER_THREAD = 4;
+
+	// Deferred commands of the chunk running on this thread (nullptr outside jobs)
+	thread_local std::vector<std::function<void()>>* t_commandQueue = nullptr;
+}
+
+
+JobSystem::JobSystem()
+	: m_pendingChunks(0)
+{
+}
+
+
+JobSystem::~JobSystem()
+{
+	close();
+}
+
+
+bool JobSystem::init(int workersCount)
+{
+	if (!m_workers.empty())
+	{
+		OutputLog("WARNING: The job system has already been initialized!");
+		return false;
+	}
+
+	if (workersCount < 0)
+	{
+		// hardware_concurrency may return 0 if it can't tell
+		workersCount = std::max((int)std::thread::hardware_concurrency() - 1, 0);
+	}
+
+	m_queues.clear();
+	for (int i = 0; i <= workersCount; ++i)
+	{
+		m_queues.push_back(std::unique_ptr<ChunkQueue>(new ChunkQueue()));
+	}
+	m_shouldStop = false;
+	for (int i = 1; i <= workersCount; ++i)
+	{
+		m_workers.push_back(std::thread(&JobSystem::workerLoop, this, i));
+	}
+
+	OutputLog("INFO: Job system started with %i workers.", workersCount);
+	return true;
+}
+
+
+void JobSystem::close()
+{
+	if (m_workers.empty())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shouldStop = true;
+	}
+	m_jobCondition.notify_all();
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+	m_workers.clear();
+}
+
+
+int JobSystem::getWorkersCount() const
+{
+	return m_workers.size();
+}
+
+
+void JobSystem::parallelFor(int count, int minChunkSize, const std::function<void(int, int)>& rangeJob)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+
+	int threadsCount = m_workers.size() + 1;
+	int chunksCount = std::min(count / std::max(minChunkSize, 1), threadsCount * CHUNKS_PER_THREAD);
+	if (chunksCount <= 1 || isInJob())
+	{
+		rangeJob(0, count);
+		return;
+	}
+
+	m_rangeJob = &rangeJob;
+	m_count = count;
+	m_chunkSize = (count + chunksCount - 1) / chunksCount;
+	chunksCount = (count + m_chunkSize - 1) / m_chunkSize;
+	m_chunkCommands.resize(chunksCount);
+	m_pendingChunks = chunksCount;
+
+	// Consecutive chunks go to different threads, so that each of them starts with a share of the whole range
+	for (int chunk = 0; chunk < chunksCount; ++chunk)
+	{
+		ChunkQueue& queue = *m_queues[chunk % threadsCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.chunks.push_back(chunk);
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_jobGeneration;
+	}
+	m_jobCondition.notify_all();
+
+	// The calling thread works too, and then waits for the chunks still running on the workers
+	runChunks(0);
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_doneCondition.wait(lock, [this]() -> bool { return m_pendingChunks == 0; });
+	}
+	m_rangeJob = nullptr;
+
+	applyDeferredCommands();
+}
+
+
+void JobSystem::defer(const std::function<void()>& command)
+{
+	if (t_commandQueue != nullptr)
+	{
+		t_commandQueue->push_back(command);
+	}
+	else
+	{
+		command();
+	}
+}
+
+
+bool JobSystem::isInJob() const
+{
+	return t_commandQueue != nullptr;
+}
+
+
+void JobSystem::workerLoop(int queueIndex)
+{
+	int seenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_jobCondition.wait(lock, [this, seenGeneration]() -> bool { return m_shouldStop || m_jobGeneration != seenGeneration; });
+			if (m_shouldStop)
+			{
+				return;
+			}
+			seenGeneration = m_jobGeneration;
+		}
+
+		// A worker that wakes up late just finds every queue empty
+		runChunks(queueIndex);
+	}
+}
+
+
+void JobSystem::runChunks(int queueIndex)
+{
+	int chunk;
+	while (popChunk(queueIndex, chunk) || stealChunk(queueIndex, chunk))
+	{
+		runChunk(chunk);
+	}
+}
+
+
+bool JobSystem::popChunk(int queueIndex, int& chunk)
+{
+	ChunkQueue& queue = *m_queues[queueIndex];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.chunks.empty())
+	{
+		return false;
+	}
+	chunk = queue.chunks.back();
+	queue.chunks.pop_back();
+	return true;
+}
+
+
+bool JobSystem::stealChunk(int queueIndex, int& chunk)
+{
+	int queuesCount = m_queues.size();
+	for (int i = 1; i < queuesCount; ++i)
+	{
+		ChunkQueue& queue = *m_queues[(queueIndex + i) % queuesCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.chunks.empty())
+		{
+			chunk = queue.chunks.front();
+			queue.chunks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void JobSystem::runChunk(int chunk)
+{
+	int begin = chunk * m_chunkSize;
+	int end = std::min(begin + m_chunkSize, m_count);
+
+	t_commandQueue = &m_chunkCommands[chunk];
+	(*m_rangeJob)(begin, end);
+	t_commandQueue = nullptr;
+
+	// Locking before notifying ensures the calling thread can't miss the notification between its check and its wait
+	if (--m_pendingChunks == 0)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_doneCondition.notify_one();
+	}
+}
+
+
+void JobSystem::applyDeferredCommands()
+{
+	// Note: the commands run outside any job, so the ones they defer in turn run right away (and they may start a new job)
+	std::vector<std::vector<std::function<void()>>> chunkCommands;
+	chunkCommands.swap(m_chunkCommands);
+	for (std::vector<std::function<void()>>& commands : chunkCommands)
+	{
+		for (std::function<void()>& command : commands)
+		{
+			command();
+		}
+	}
+}
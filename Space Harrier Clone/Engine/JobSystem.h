@@ -0,0 +1,69 @@
+#ifndef H_JOB_SYSTEM
+#define H_JOB_SYSTEM
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+
+// Runs data-parallel jobs on a pool of worker threads (plus the calling thread), which steal chunks from each other when idle
+// Jobs must not touch shared state directly: their side effects are deferred, and applied serially once the job is done
+class JobSystem final
+{
+public:
+	JobSystem();
+	~JobSystem();
+
+	// A negative workersCount uses one worker per additional hardware thread (0 runs every job on the calling thread)
+	bool init(int workersCount);
+	void close();
+	int getWorkersCount() const;
+
+	// Splits [0, count) in chunks of at least minChunkSize items and calls rangeJob(begin, end) for each of them
+	// Returns once every chunk has run and their deferred commands have been applied (in chunk order, so the result is deterministic)
+	// Note: nested calls (from inside a job) run serially
+	void parallelFor(int count, int minChunkSize, const std::function<void(int, int)>& rangeJob);
+
+	// Inside a job, queues command to run after the job. Otherwise, runs it right away
+	void defer(const std::function<void()>& command);
+	bool isInJob() const;
+
+private:
+	// Each thread (the calling thread is queue 0) pops from the back of its own queue, and steals from the front of the others
+	struct ChunkQueue
+	{
+		std::deque<int> chunks;
+		std::mutex mutex;
+	};
+
+	void workerLoop(int queueIndex);
+	void runChunks(int queueIndex);
+	bool popChunk(int queueIndex, int& chunk);
+	bool stealChunk(int queueIndex, int& chunk);
+	void runChunk(int chunk);
+	void applyDeferredCommands();
+
+	std::vector<std::thread> m_workers;
+	std::vector<std::unique_ptr<ChunkQueue>> m_queues;
+
+	// Current job (only written by the calling thread, while no chunk is pending)
+	const std::function<void(int, int)>* m_rangeJob = nullptr;
+	int m_count = 0;
+	int m_chunkSize = 0;
+	std::vector<std::vector<std::function<void()>>> m_chunkCommands;
+	std::atomic<int> m_pendingChunks;
+
+	std::mutex m_mutex;
+	std::condition_variable m_jobCondition;
+	std::condition_variable m_doneCondition;
+	int m_jobGeneration = 0;
+	bool m_shouldStop = false;
+};
+
+
+#endif // !H_JOB_SYSTEM
@@ -0,0 +1,50 @@
+#include "Matrix2x3.h"
+
+
+Matrix2x3::Matrix2x3()
+	: m00(1), m01(0), m10(0), m11(1), translation(0, 0)
+{
+}
+
+
+Matrix2x3::Matrix2x3(float m00, float m01, float m10, float m11, const Vector2& translation)
+	: m00(m00), m01(m01), m10(m10), m11(m11), translation(translation)
+{
+}
+
+
+Vector2 Matrix2x3::transformPoint(const Vector2& point) const
+{
+	return Vector2(m00 * point.x + m01 * point.y + translation.x, m10 * point.x + m11 * point.y + translation.y);
+}
+
+
+void Matrix2x3::transformPoints(const Vector2* points, Vector2* transformedPoints, int count) const
+{
+	for (int i = 0; i < count; ++i)
+	{
+		float x = points[i].x;
+		float y = points[i].y;
+		transformedPoints[i].x = m00 * x + m01 * y + translation.x;
+		transformedPoints[i].y = m10 * x + m11 * y + translation.y;
+	}
+}
+
+
+bool Matrix2x3::getInverse(Matrix2x3& inverseMatrix) const
+{
+	float determinant = m00 * m11 - m01 * m10;
+	if (determinant == 0)
+	{
+		return false;
+	}
+	float inverseDeterminant = 1 / determinant;
+	inverseMatrix.m00 = m11 * inverseDeterminant;
+	inverseMatrix.m01 = -m01 * inverseDeterminant;
+	inverseMatrix.m10 = -m10 * inverseDeterminant;
+	inverseMatrix.m11 = m00 * inverseDeterminant;
+	// The inverse translation undoes the translation in the inverted linear space
+	inverseMatrix.translation.x = -(inverseMatrix.m00 * translation.x + inverseMatrix.m01 * translation.y);
+	inverseMatrix.translation.y = -(inverseMatrix.m10 * translation.x + inverseMatrix.m11 * translation.y);
+	return true;
+}
@@ -0,0 +1,28 @@
+#ifndef H_MATRIX_2X3
+#define H_MATRIX_2X3
+
+#include "Vector2.h"
+
+
+// 2D affine transformation: a 2x2 linear part (rotation and scale) followed by a translation
+class Matrix2x3 final
+{
+public:
+	// Identity
+	Matrix2x3();
+	Matrix2x3(float m00, float m01, float m10, float m11, const Vector2& translation);
+
+	Vector2 transformPoint(const Vector2& point) const;
+	void transformPoints(const Vector2* points, Vector2* transformedPoints, int count) const;
+	// Returns false (leaving inverseMatrix untouched) if the matrix can't be inverted
+	bool getInverse(Matrix2x3& inverseMatrix) const;
+
+	float m00;
+	float m01;
+	float m10;
+	float m11;
+	Vector2 translation;
+};
+
+
+#endif // !H_MATRIX_2X3
@@ -0,0 +1,181 @@
+#include "PoolAllocator.h"
+
+#include <new>
+#include "globals.h"
+
+
+namespace
+{
+	// Block sizes are multiples of the granularity (which also keeps the blocks aligned)
+	const size_t SIZE_CLASS_GRANULARITY = 16;
+	const int SIZE_CLASSES_COUNT = 64;
+	const size_t PAGE_SIZE = 16384;
+}
+
+
+PoolAllocator::PoolAllocator()
+	: m_sizeClasses(SIZE_CLASSES_COUNT)
+{
+}
+
+
+PoolAllocator::~PoolAllocator()
+{
+	if (!releaseAll())
+	{
+		// Freeing the pages would leave the remaining objects dangling, so they are leaked instead
+		OutputLog("WARNING: %i pooled objects are still alive on shutdown!", getLiveBlocksCount());
+	}
+}
+
+
+void* PoolAllocator::allocate(size_t size)
+{
+	int sizeClassIndex = getSizeClassIndex(size);
+	if (sizeClassIndex == -1)
+	{
+		++m_largeAllocations;
+		++m_liveLargeAllocations;
+		return ::operator new(size);
+	}
+
+	SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+	if (sizeClass.freeList == nullptr)
+	{
+		addPage(sizeClassIndex);
+	}
+	void* block = sizeClass.freeList;
+	sizeClass.freeList = *static_cast<void**>(block);
+
+	++sizeClass.allocations;
+	++sizeClass.liveBlocks;
+	if (sizeClass.liveBlocks > sizeClass.peakLiveBlocks)
+	{
+		sizeClass.peakLiveBlocks = sizeClass.liveBlocks;
+	}
+	return block;
+}
+
+
+void PoolAllocator::deallocate(void* ptr, size_t size)
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	int sizeClassIndex = getSizeClassIndex(size);
+	if (sizeClassIndex == -1)
+	{
+		--m_liveLargeAllocations;
+		::operator delete(ptr);
+		return;
+	}
+
+	SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+	*static_cast<void**>(ptr) = sizeClass.freeList;
+	sizeClass.freeList = ptr;
+	--sizeClass.liveBlocks;
+}
+
+
+bool PoolAllocator::releaseAll()
+{
+	if (getLiveBlocksCount() > 0)
+	{
+		return false;
+	}
+
+	int releasedPages = 0;
+	for (SizeClass& sizeClass : m_sizeClasses)
+	{
+		for (char* page : sizeClass.pages)
+		{
+			::operator delete(page);
+		}
+		releasedPages += sizeClass.pages.size();
+		sizeClass.pages.clear();
+		sizeClass.freeList = nullptr;
+	}
+	if (releasedPages > 0)
+	{
+		OutputLog("INFO: Released %i object pool pages (%i KB).", releasedPages, (int)(releasedPages * PAGE_SIZE / 1024));
+	}
+	return true;
+}
+
+
+int PoolAllocator::getLiveBlocksCount() const
+{
+	int liveBlocks = 0;
+	for (const SizeClass& sizeClass : m_sizeClasses)
+	{
+		liveBlocks += sizeClass.liveBlocks;
+	}
+	return liveBlocks;
+}
+
+
+void PoolAllocator::logReport() const
+{
+	int allocations = 0;
+	int pages = 0;
+	for (const SizeClass& sizeClass : m_sizeClasses)
+	{
+		allocations += sizeClass.allocations;
+		pages += sizeClass.pages.size();
+	}
+	OutputLog("INFO: Object pools: %i allocations (and %i too large to be pooled), %i blocks in use, %i pages:", allocations, m_largeAllocations, getLiveBlocksCount(), pages);
+
+	for (unsigned int i = 0; i < m_sizeClasses.size(); ++i)
+	{
+		const SizeClass& sizeClass = m_sizeClasses[i];
+		if (sizeClass.allocations > 0)
+		{
+			int capacity = sizeClass.pages.size() * getBlocksPerPage(i);
+			OutputLog("INFO:   %4i bytes  in use: %6i / %6i  peak: %6i  allocations: %8i", (int)getBlockSize(i), sizeClass.liveBlocks, capacity, sizeClass.peakLiveBlocks, sizeClass.allocations);
+		}
+	}
+}
+
+
+int PoolAllocator::getSizeClassIndex(size_t size) const
+{
+	int sizeClassIndex = (size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY - 1;
+	if (sizeClassIndex < 0)
+	{
+		sizeClassIndex = 0;
+	}
+	return sizeClassIndex < SIZE_CLASSES_COUNT ? sizeClassIndex : -1;
+}
+
+
+size_t PoolAllocator::getBlockSize(int sizeClassIndex) const
+{
+	return (sizeClassIndex + 1) * SIZE_CLASS_GRANULARITY;
+}
+
+
+int PoolAllocator::getBlocksPerPage(int sizeClassIndex) const
+{
+	return PAGE_SIZE / getBlockSize(sizeClassIndex);
+}
+
+
+void PoolAllocator::addPage(int sizeClassIndex)
+{
+	SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+	size_t blockSize = getBlockSize(sizeClassIndex);
+	int blocksCount = getBlocksPerPage(sizeClassIndex);
+
+	char* page = static_cast<char*>(::operator new(PAGE_SIZE));
+	sizeClass.pages.push_back(page);
+
+	// Thread the new blocks in address order in front of the (empty) free list
+	for (int i = blocksCount - 1; i >= 0; --i)
+	{
+		void* block = page + i * blockSize;
+		*static_cast<void**>(block) = sizeClass.freeList;
+		sizeClass.freeList = block;
+	}
+}
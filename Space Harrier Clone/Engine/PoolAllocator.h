@@ -0,0 +1,50 @@
+#ifndef H_POOL_ALLOCATOR
+#define H_POOL_ALLOCATOR
+
+#include <vector>
+#include <cstddef>
+
+
+// Size-class pools for the small objects created at runtime (GameObjects and Components)
+// Each size class hands out fixed-size blocks from pages it allocates on demand, keeping the released ones in a free list
+// The pages are only given back in bulk (see releaseAll), so they act as an arena for the objects of the loaded scene
+// Note: not thread safe (objects are only created and destroyed from the main thread)
+class PoolAllocator final
+{
+public:
+	PoolAllocator();
+	~PoolAllocator();
+
+	void* allocate(size_t size);
+	// size must be the one used to allocate ptr
+	void deallocate(void* ptr, size_t size);
+
+	// Frees every page at once, as long as no block is in use (returns false and keeps them otherwise)
+	bool releaseAll();
+	int getLiveBlocksCount() const;
+	void logReport() const;
+
+private:
+	struct SizeClass
+	{
+		// Linked through the first bytes of each free block
+		void* freeList = nullptr;
+		std::vector<char*> pages;
+		int liveBlocks = 0;
+		int peakLiveBlocks = 0;
+		int allocations = 0;
+	};
+
+	int getSizeClassIndex(size_t size) const;
+	size_t getBlockSize(int sizeClassIndex) const;
+	int getBlocksPerPage(int sizeClassIndex) const;
+	void addPage(int sizeClassIndex);
+
+	std::vector<SizeClass> m_sizeClasses;
+	// Objects bigger than the largest size class go straight to the global heap
+	int m_largeAllocations = 0;
+	int m_liveLargeAllocations = 0;
+};
+
+
+#endif // !H_POOL_ALLOCATOR
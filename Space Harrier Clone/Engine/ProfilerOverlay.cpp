@@ -0,0 +1,115 @@
+#include "ProfilerOverlay.h"
+
+#include "SDL2_image/include/SDL_image.h"
+#include "globals.h"
+#include "Engine.h"
+#include "AssetPack.h"
+#include "gameConfig.h"
+#include "FrameProfiler.h"
+
+static const Uint32 OVERLAY_REFRESH_INTERVAL_MS = 500;
+
+
+ProfilerOverlay::ProfilerOverlay()
+{
+}
+
+
+ProfilerOverlay::~ProfilerOverlay()
+{
+	close();
+}
+
+
+bool ProfilerOverlay::init(SDL_Renderer* renderer, const Font& font)
+{
+	close();
+	m_renderer = renderer;
+	m_font = font;
+
+	SDL_Surface* loadedSurface = engine->assetPack->loadSurface(font.path);
+	if (loadedSurface == nullptr)
+	{
+		OutputLog("WARNING: Unable to load the profiler overlay font at path %s! SDL_image Error: %s", font.path.c_str(), IMG_GetError());
+		return false;
+	}
+	m_fontTexture = SDL_CreateTextureFromSurface(m_renderer, loadedSurface);
+	SDL_FreeSurface(loadedSurface);
+	if (m_fontTexture == nullptr)
+	{
+		OutputLog("WARNING: Unable to create the profiler overlay font texture! SDL Error: %s", SDL_GetError());
+		return false;
+	}
+	return true;
+}
+
+
+void ProfilerOverlay::close()
+{
+	if (m_fontTexture != nullptr)
+	{
+		SDL_DestroyTexture(m_fontTexture);
+		m_fontTexture = nullptr;
+	}
+	m_renderer = nullptr;
+	m_lines.clear();
+}
+
+
+void ProfilerOverlay::render(const FrameProfiler& profiler)
+{
+	if (m_fontTexture == nullptr)
+	{
+		return;
+	}
+
+	Uint32 now = SDL_GetTicks();
+	if (m_lines.empty() || now - m_lastRefreshTime >= OVERLAY_REFRESH_INTERVAL_MS)
+	{
+		refreshLines(profiler);
+		m_lastRefreshTime = now;
+	}
+
+	for (unsigned int i = 0; i < m_lines.size(); ++i)
+	{
+		renderLine(m_lines[i], m_font.characterWidth, m_font.characterHeight * (i + 1));
+	}
+}
+
+
+void ProfilerOverlay::refreshLines(const FrameProfiler& profiler)
+{
+	// Note: the fonts only have upper case letters, digits and a few symbols
+	char buffer[64];
+	m_lines.clear();
+	m_lines.push_back("MS         CUR   P50   P95   P99");
+	for (int phase = 0; phase < (int)FramePhase::COUNT; ++phase)
+	{
+		FramePhase framePhase = (FramePhase)phase;
+		SDL_snprintf(buffer, sizeof(buffer), "%-10s%5.2f %5.2f %5.2f %5.2f",
+			FrameProfiler::getPhaseName(framePhase),
+			profiler.getCurrentTime(framePhase),
+			profiler.getPercentileTime(framePhase, 50),
+			profiler.getPercentileTime(framePhase, 95),
+			profiler.getPercentileTime(framePhase, 99));
+		m_lines.push_back(buffer);
+	}
+}
+
+
+void ProfilerOverlay::renderLine(const std::string& line, int x, int y) const
+{
+	SDL_Rect sourceRect{ 0, 0, m_font.characterWidth, m_font.characterHeight };
+	SDL_Rect destinationRect{ x * SCREEN_SIZE, y * SCREEN_SIZE, m_font.characterWidth * SCREEN_SIZE, m_font.characterHeight * SCREEN_SIZE };
+	for (char c : line)
+	{
+		auto it = m_font.charsTopLeftCorners.find(c);
+		if (it != m_font.charsTopLeftCorners.end())
+		{
+			sourceRect.x = it->second.x;
+			sourceRect.y = it->second.y;
+			SDL_RenderCopy(m_renderer, m_fontTexture, &sourceRect, &destinationRect);
+		}
+		destinationRect.x += m_font.characterWidth * SCREEN_SIZE;
+	}
+}
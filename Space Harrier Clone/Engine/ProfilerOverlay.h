@@ -0,0 +1,37 @@
+#ifndef H_PROFILER_OVERLAY
+#define H_PROFILER_OVERLAY
+
+#include <vector>
+#include <string>
+#include "SDL2/include/SDL_render.h"
+#include "Font.h"
+class FrameProfiler;
+
+
+// Draws the FrameProfiler times on top of the frame with a TextRenderer font (current, p50, p95 and p99 per phase)
+class ProfilerOverlay final
+{
+public:
+	ProfilerOverlay();
+	~ProfilerOverlay();
+
+	bool init(SDL_Renderer* renderer, const Font& font);
+	void close();
+
+	void render(const FrameProfiler& profiler);
+
+private:
+	void refreshLines(const FrameProfiler& profiler);
+	void renderLine(const std::string& line, int x, int y) const;
+
+	SDL_Renderer* m_renderer = nullptr;
+	SDL_Texture* m_fontTexture = nullptr;
+	Font m_font;
+
+	// The text is only refreshed a few times per second, so that it can be read
+	std::vector<std::string> m_lines;
+	Uint32 m_lastRefreshTime = 0;
+};
+
+
+#endif // !H_PROFILER_OVERLAY
@@ -53,26 +53,19 @@ std::vector<Vector2> RectangleCollider::getWorldCorners()
 
 	// If it was empty, we recalculate the m_worldCorners
 
-	// Scale the size
-	Vector2 scaledSize = getWorldScaledSize();
-
-	// Now we create a std::vector to hold the unrotated centerToCorner vectors
-	std::vector<Vector2> centerToCornerVectors =
+	// The corners relative to the transform (unscaled and unrotated), in a CW fashion
+	Vector2 localCorners[4] =
 	{
-		Vector2(-scaledSize.x / 2, -scaledSize.y / 2),
-		Vector2(-scaledSize.x / 2, +scaledSize.y / 2),
-		Vector2(+scaledSize.x / 2, +scaledSize.y / 2),
-		Vector2(+scaledSize.x / 2, -scaledSize.y / 2)
+		offset + Vector2(-size.x / 2, -size.y / 2),
+		offset + Vector2(-size.x / 2, +size.y / 2),
+		offset + Vector2(+size.x / 2, +size.y / 2),
+		offset + Vector2(+size.x / 2, -size.y / 2)
 	};
 
-	// Next, we iterate throught these centerToCorner vectors
-	for (Vector2 centerToCornerVector : centerToCornerVectors)
-	{
-		// First, rotate it
-		centerToCornerVector.rotateCCWDegrees(m_cachedWorldRotation);
-		// Next calculate the cornerVector using the scaled offset and add to the cache std::vector
-		m_worldCorners.push_back(m_cachedWorldPosition + getWorldScaledOffset() + centerToCornerVector);
-	}
+	// Then the transform's matrix takes them all to world space in one go
+	Vector2 worldCorners[4];
+	gameObject()->transform->transformPointsToWorld(localCorners, worldCorners, 4);
+	m_worldCorners.assign(worldCorners, worldCorners + 4);
 
 	return m_worldCorners;
 }
@@ -36,7 +36,7 @@ public:
 	T* operator->();
 
 private:
-	Reference(std::list<ReferenceBase*>* referencesList, void* dataPtr);
+	explicit Reference(const ReferenceBase* source);
 };
 
 
@@ -49,8 +49,8 @@ Reference<T>::Reference()
 
 
 template<typename T>
-Reference<T>::Reference(std::list<ReferenceBase*>* referencesList, void * dataPtr)
-	: ReferenceBase(referencesList, dataPtr)
+Reference<T>::Reference(const ReferenceBase* source)
+	: ReferenceBase(source)
 {
 	//OutputLog("DEBUG: Reference params constructor");
 }
@@ -66,7 +66,7 @@ Reference<T>::~Reference()
 
 template<typename T>
 Reference<T>::Reference(const Reference& source)
-	: ReferenceBase(source.m_referencesList, source.m_dataPtr)
+	: ReferenceBase(&source)
 {
 	//OutputLog("DEBUG: Reference copy constructor");
 }
@@ -75,7 +75,7 @@ Reference<T>::Reference(const Reference& source)
 template<typename T>
 template<typename U>
 Reference<T>::Reference(const Reference<U>& source)
-	: ReferenceBase(source.m_referencesList, source.m_dataPtr)
+	: ReferenceBase(&source)
 {
 	//OutputLog("DEBUG: Reference generalized copy constructor");
 	// This is only added to cause a compile-time error in case no implicit conversion exists to convert a U* into a T*
@@ -92,9 +92,7 @@ Reference<T>& Reference<T>::operator=(const Reference & source)
 		return *this;
 	}
 	reset();
-	m_referencesList = source.m_referencesList;
-	m_dataPtr = source.m_dataPtr;
-	addReference();
+	linkTo(&source);
 	return *this;
 }
 
@@ -111,7 +109,7 @@ template<typename T>
 template<typename U>
 Reference<U> Reference<T>::static_reference_cast() const
 {
-	return Reference<U>(this->m_referencesList, this->m_dataPtr);
+	return Reference<U>(this);
 }
 
 
@@ -121,7 +119,7 @@ Reference<U> Reference<T>::dynamic_reference_cast() const
 {
 	if (dynamic_cast<U*>(static_cast<T*>(this->m_dataPtr)))
 	{
-		return Reference<U>(this->m_referencesList, this->m_dataPtr);
+		return Reference<U>(this);
 	}
 	else
 	{
@@ -5,7 +5,7 @@
 
 bool operator==(const ReferenceBase& lhs, const ReferenceBase& rhs)
 {
-	return (lhs.m_referencesList && rhs.m_referencesList && lhs.m_referencesList == rhs.m_referencesList);
+	return (lhs.m_dataPtr && lhs.m_dataPtr == rhs.m_dataPtr);
 }
 
 
@@ -16,14 +16,15 @@ bool operator!=(const ReferenceBase & lhs, const ReferenceBase & rhs)
 
 
 ReferenceBase::ReferenceBase()
+	: m_previous(this), m_next(this)
 {
 }
 
 
-ReferenceBase::ReferenceBase(std::list<ReferenceBase*>* referencesList, void * dataPtr)
-	: m_referencesList(referencesList), m_dataPtr(dataPtr)
+ReferenceBase::ReferenceBase(const ReferenceBase* source)
+	: m_previous(this), m_next(this)
 {
-	addReference();
+	linkTo(source);
 }
 
 
@@ -39,26 +40,33 @@ ReferenceBase::operator bool() const
 }
 
 
-void ReferenceBase::addReference()
+void ReferenceBase::linkTo(const ReferenceBase* source)
 {
-	if (m_referencesList != nullptr)
+	assert(m_next == this && m_previous == this);
+	if (source == nullptr || source->m_dataPtr == nullptr)
 	{
-		m_referencesList->push_back(this);
+		return;
 	}
+
+	// Insert this Reference right after source (linking never changes what source refers to)
+	ReferenceBase* previous = const_cast<ReferenceBase*>(source);
+	m_dataPtr = previous->m_dataPtr;
+	m_previous = previous;
+	m_next = previous->m_next;
+	previous->m_next->m_previous = this;
+	previous->m_next = this;
 }
 
 
 void ReferenceBase::reset()
 {
-	if (m_referencesList != nullptr)
+	if (m_dataPtr != nullptr)
 	{
-		auto it = std::find(m_referencesList->begin(), m_referencesList->end(), this);
-		m_referencesList->erase(it);
-		if (m_referencesList->size() == 0)
-		{
-			delete m_referencesList;
-		}
-		m_referencesList = nullptr;
+		// Unlink this Reference from the rest
+		m_previous->m_next = m_next;
+		m_next->m_previous = m_previous;
+		m_previous = this;
+		m_next = this;
 		m_dataPtr = nullptr;
 	}
 }
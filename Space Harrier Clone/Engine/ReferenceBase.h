@@ -1,9 +1,9 @@
 #ifndef H_REFERENCE_BASE
 #define H_REFERENCE_BASE
 
-#include <list>
-
 
+// All the References to the same object (its ReferenceOwner included) are linked in an intrusive circular list,
+// so that copying, destroying and invalidating a Reference never allocates and takes constant time
 class ReferenceBase
 {
 	template<typename T>
@@ -22,11 +22,16 @@ public:
 	void reset();
 
 protected:
-	ReferenceBase(std::list<ReferenceBase*>* referencesList, void* dataPtr);
-	void addReference();
+	// Creates a Reference to the same object as source (an empty one if source is empty)
+	explicit ReferenceBase(const ReferenceBase* source);
+	void linkTo(const ReferenceBase* source);
 
-	std::list<ReferenceBase*>* m_referencesList = nullptr;
 	void* m_dataPtr = nullptr;
+
+private:
+	// Neighbours in the list of References to the same object (an empty Reference is linked to itself)
+	ReferenceBase* m_previous;
+	ReferenceBase* m_next;
 };
 
 bool operator==(const ReferenceBase& lhs, const ReferenceBase& rhs);
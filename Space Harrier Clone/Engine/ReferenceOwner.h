@@ -1,7 +1,6 @@
 #ifndef H_REFERENCE_OWNER
 #define H_REFERENCE_OWNER
 
-#include <list>
 #include <assert.h>
 //#include "globals.h"
 #include "Reference.h"
@@ -43,8 +42,9 @@ ReferenceOwner<T>::ReferenceOwner()
 
 template<typename T>
 ReferenceOwner<T>::ReferenceOwner(T* dataPtr)
-	: Reference<T>(new std::list<ReferenceBase*>(), static_cast<void*>(dataPtr))
+	: Reference<T>()
 {
+	this->m_dataPtr = static_cast<void*>(dataPtr);
 	//OutputLog("DEBUG: ReferenceOwner params constructor");
 }
 
@@ -59,7 +59,7 @@ ReferenceOwner<T>::~ReferenceOwner()
 
 template<typename T>
 ReferenceOwner<T>::ReferenceOwner(ReferenceOwner && source)
-	: Reference<T>(source.m_referencesList, source.m_dataPtr)
+	: Reference<T>(&source)
 {
 	//OutputLog("DEBUG: ReferenceOwner move constructor");
 	source.reset();
@@ -69,7 +69,7 @@ ReferenceOwner<T>::ReferenceOwner(ReferenceOwner && source)
 template<typename T>
 template<typename U>
 ReferenceOwner<T>::ReferenceOwner(ReferenceOwner<U>&& source)
-	: Reference<T>(source.m_referencesList, source.m_dataPtr)
+	: Reference<T>(&source)
 {
 	//OutputLog("DEBUG: ReferenceOwner generalized move constructor");
 	// This is only added to cause a compile-time error in case no implicit conversion exists to convert a U* into a T*
@@ -88,9 +88,7 @@ ReferenceOwner<T>& ReferenceOwner<T>::operator=(ReferenceOwner && source)
 	}
 	this->deleteReferences();
 
-	this->m_referencesList = source.m_referencesList;
-	this->m_dataPtr = source.m_dataPtr;
-	this->addReference();
+	this->linkTo(&source);
 	source.reset();
 
 	return *this;
@@ -100,14 +98,23 @@ ReferenceOwner<T>& ReferenceOwner<T>::operator=(ReferenceOwner && source)
 template<typename T>
 int ReferenceOwner<T>::getRefCount() const
 {
-	return this->m_referencesList != nullptr ? this->m_referencesList->size() : 0;
+	if (this->m_dataPtr == nullptr)
+	{
+		return 0;
+	}
+	int refCount = 1;
+	for (const ReferenceBase* ref = this->m_next; ref != this; ref = ref->m_next)
+	{
+		++refCount;
+	}
+	return refCount;
 }
 
 
 template<typename T>
 Reference<T> ReferenceOwner<T>::getReference() const
 {
-	return Reference<T>(this->m_referencesList, this->m_dataPtr);;
+	return Reference<T>(this);
 }
 
 
@@ -130,24 +137,27 @@ Reference<U> ReferenceOwner<T>::getDynamicCastedReference() const
 template<typename T>
 void ReferenceOwner<T>::deleteReferences()
 {
-	if (this->m_dataPtr == nullptr || this->m_referencesList == nullptr)
+	if (this->m_dataPtr == nullptr)
 	{
 		return;
 	}
 
+	// Note: References destroyed by the object's destructor simply unlink themselves
 	delete static_cast<T*>(this->m_dataPtr);
 
-	for (auto& ref : *(this->m_referencesList))
+	// Empty every other Reference (leaving each one linked to itself), and then this one
+	ReferenceBase* ref = this->m_next;
+	while (ref != this)
 	{
-		if (this != ref)
-		{
-			ref->m_dataPtr = nullptr;
-			ref->m_referencesList = nullptr;
-		}
+		ReferenceBase* next = ref->m_next;
+		ref->m_dataPtr = nullptr;
+		ref->m_previous = ref;
+		ref->m_next = ref;
+		ref = next;
 	}
-	
-	delete this->m_referencesList;
-	this->m_referencesList = nullptr;
+	this->m_dataPtr = nullptr;
+	this->m_previous = this;
+	this->m_next = this;
 }
 
 
@@ -0,0 +1,126 @@
+#include "RenderLayerCache.h"
+
+#include "globals.h"
+#include "Renderer.h"
+
+
+RenderLayerCache::RenderLayerCache()
+{
+}
+
+
+RenderLayerCache::~RenderLayerCache()
+{
+	close();
+}
+
+
+bool RenderLayerCache::init(SDL_Renderer* renderer, int width, int height)
+{
+	close();
+
+	m_renderer = renderer;
+	m_texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+	if (m_texture == nullptr)
+	{
+		OutputLog("ERROR: Unable to create the render layer cache texture! SDL Error: %s", SDL_GetError());
+		return false;
+	}
+
+	// Renderers are alpha-blended into the cleared texture, which leaves its colours premultiplied by alpha,
+	// so the cache is drawn on top of the previous layers with a premultiplied-alpha blend mode
+	SDL_BlendMode premultipliedBlendMode = SDL_ComposeCustomBlendMode(
+		SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+		SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+	if (SDL_SetTextureBlendMode(m_texture, premultipliedBlendMode) != 0)
+	{
+		SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+	}
+	m_isValid = false;
+	return true;
+}
+
+
+void RenderLayerCache::close()
+{
+	if (m_texture != nullptr)
+	{
+		SDL_DestroyTexture(m_texture);
+		m_texture = nullptr;
+	}
+	m_renderer = nullptr;
+	m_isValid = false;
+}
+
+
+bool RenderLayerCache::needsRebuild(const std::list<Reference<Renderer>>& renderers) const
+{
+	if (!m_isValid)
+	{
+		return true;
+	}
+
+	for (const Reference<Renderer>& renderer : renderers)
+	{
+		if (renderer->hasChangedSinceComposed())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void RenderLayerCache::invalidate()
+{
+	m_isValid = false;
+}
+
+
+bool RenderLayerCache::rebuild(std::list<Reference<Renderer>>& renderers)
+{
+	if (m_texture == nullptr)
+	{
+		return false;
+	}
+
+	// Change the renderer's render target to the cache texture (keeping a reference to the original target)
+	SDL_Texture* originalTarget = SDL_GetRenderTarget(m_renderer);
+	if (SDL_SetRenderTarget(m_renderer, m_texture) != 0)
+	{
+		OutputLog("WARNING: Unable to compose a render layer cache! SDL Error: %s", SDL_GetError());
+		return false;
+	}
+
+	// Set Render Color to black transparent and clear the texture
+	SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+	SDL_RenderClear(m_renderer);
+
+	for (Reference<Renderer>& renderer : renderers)
+	{
+		if (renderer->isActive())
+		{
+			renderer->render();
+		}
+		renderer->storeComposedState();
+	}
+
+	// Change the renderer's render target back to the original target
+	SDL_SetRenderTarget(m_renderer, originalTarget);
+
+	m_isValid = true;
+	++m_rebuildsCount;
+	return true;
+}
+
+
+void RenderLayerCache::render() const
+{
+	SDL_RenderCopy(m_renderer, m_texture, nullptr, nullptr);
+}
+
+
+int RenderLayerCache::getRebuildsCount() const
+{
+	return m_rebuildsCount;
+}
@@ -0,0 +1,39 @@
+#ifndef H_RENDER_LAYER_CACHE
+#define H_RENDER_LAYER_CACHE
+
+#include <list>
+#include "SDL2/include/SDL_render.h"
+#include "Reference.h"
+class Renderer;
+
+
+// Off-screen texture holding the composed output of a render layer, so that a layer which rarely changes
+// is drawn as a single quad instead of re-rendering every one of its renderers each frame
+class RenderLayerCache final
+{
+public:
+	RenderLayerCache();
+	~RenderLayerCache();
+
+	bool init(SDL_Renderer* renderer, int width, int height);
+	void close();
+
+	// Whether any renderer of the layer changed since the last composition (or the cache was invalidated)
+	bool needsRebuild(const std::list<Reference<Renderer>>& renderers) const;
+	void invalidate();
+
+	// Composes the active renderers into the cached texture. Returns false if the cache cannot be used
+	bool rebuild(std::list<Reference<Renderer>>& renderers);
+	void render() const;
+
+	int getRebuildsCount() const;
+
+private:
+	SDL_Renderer* m_renderer = nullptr;
+	SDL_Texture* m_texture = nullptr;
+	bool m_isValid = false;
+	int m_rebuildsCount = 0;
+};
+
+
+#endif // !H_RENDER_LAYER_CACHE
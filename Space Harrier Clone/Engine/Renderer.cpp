@@ -5,7 +5,9 @@
 #include "GameObject.h"
 #include "Transform.h"
 #include "ComponentType.h"
-#include "ResourcesManager.h"
+#include "ResourceCache.h"
+#include "Engine.h"
+#include "TimeController.h"
 
 
 Renderer::Renderer()
@@ -50,6 +52,7 @@ Vector2 Renderer::getPositionPivot() const
 void Renderer::setPositionPivot(const Vector2& positionPivot)
 {
 	m_positionPivot = positionPivot;
+	markAsChanged();
 }
 
 
@@ -62,6 +65,7 @@ Vector2 Renderer::getRotationPivot() const
 void Renderer::setRotationPivot(const Vector2& rotationPivot)
 {
 	m_rotationPivot = rotationPivot;
+	markAsChanged();
 }
 
 
@@ -74,6 +78,7 @@ Vector2 Renderer::getScalePivot() const
 void Renderer::setScalePivot(const Vector2& scalePivot)
 {
 	m_scalePivot = scalePivot;
+	markAsChanged();
 }
 
 
@@ -115,6 +120,72 @@ void Renderer::setZIndex(int zIndex)
 }
 
 
+void Renderer::snapToTransform()
+{
+	m_hasTickState = false;
+}
+
+
+bool Renderer::hasChangedSinceComposed() const
+{
+	bool active = isActive();
+	if (m_hasChanged || active != m_wasComposedActive)
+	{
+		return true;
+	}
+	// An inactive renderer is not drawn, so its transform does not matter
+	if (!active || !gameObject()->transform)
+	{
+		return false;
+	}
+
+	Vector2 position;
+	float rotation;
+	Vector2 scale;
+	getRenderTransform(position, rotation, scale);
+	return position != m_composedPosition || rotation != m_composedRotation || scale != m_composedScale;
+}
+
+
+void Renderer::markAsChanged()
+{
+	m_hasChanged = true;
+}
+
+
+void Renderer::advanceAnimation()
+{
+}
+
+
+void Renderer::getRenderTransform(Vector2& worldPosition, float& worldRotation, Vector2& worldScale) const
+{
+	const Reference<Transform>& transform = gameObject()->transform;
+	worldPosition = transform->getWorldPosition();
+	worldRotation = transform->getWorldRotation();
+	worldScale = transform->getWorldScale();
+	if (!m_hasTickState)
+	{
+		return;
+	}
+
+	float factor = engine->time->interpolationFactor();
+	worldPosition = m_tickPosition + (worldPosition - m_tickPosition) * factor;
+	worldScale = m_tickScale + (worldScale - m_tickScale) * factor;
+	// Rotations are interpolated the short way around
+	float rotationDifference = worldRotation - m_tickRotation;
+	if (rotationDifference > 180)
+	{
+		rotationDifference -= 360;
+	}
+	else if (rotationDifference < -180)
+	{
+		rotationDifference += 360;
+	}
+	worldRotation = m_tickRotation + rotationDifference * factor;
+}
+
+
 void Renderer::renderMain(SDL_Rect* clip, SDL_RendererFlip flip) const
 {
 	if (m_renderer == nullptr || m_texture == nullptr)
@@ -128,9 +199,24 @@ void Renderer::renderMain(SDL_Rect* clip, SDL_RendererFlip flip) const
 	}
 
 	// Extract info from the transform
-	Vector2 pos = gameObject()->transform->getWorldPosition();
-	float rot = gameObject()->transform->getWorldRotation();
-	Vector2 sca = gameObject()->transform->getWorldScale();
+	Vector2 position;
+	float rotation;
+	Vector2 scale;
+	getRenderTransform(position, rotation, scale);
+	renderMain(position, rotation, scale, clip, flip);
+}
+
+
+void Renderer::renderMain(const Vector2& worldPosition, float worldRotation, const Vector2& worldScale, SDL_Rect* clip, SDL_RendererFlip flip) const
+{
+	if (m_renderer == nullptr || m_texture == nullptr)
+	{
+		return;
+	}
+
+	Vector2 pos = worldPosition;
+	float rot = worldRotation;
+	const Vector2& sca = worldScale;
 
 	// Correct the position and rotations to simulate a reference system with 0 in the bottom-left,
 	// x increasing to the right (same as SDL) and Y increasing up (opposite of SDL)
@@ -148,6 +234,28 @@ void Renderer::renderMain(SDL_Rect* clip, SDL_RendererFlip flip) const
 		rawSize = { (float)m_width, (float)m_height };
 	}
 
+	// Images packed in a texture atlas have their clip rects remapped to atlas coordinates
+	SDL_Rect atlasClip;
+	if (m_isInAtlas)
+	{
+		if (clip)
+		{
+			// Clamped to the image (as SDL does with standalone textures), so that its neighbours in the atlas are never sampled
+			SDL_Rect imageRect = { 0, 0, m_atlasRegion.w, m_atlasRegion.h };
+			if (!SDL_IntersectRect(clip, &imageRect, &atlasClip))
+			{
+				return;
+			}
+			atlasClip.x += m_atlasRegion.x;
+			atlasClip.y += m_atlasRegion.y;
+		}
+		else
+		{
+			atlasClip = m_atlasRegion;
+		}
+		clip = &atlasClip;
+	}
+
 	// Set the rendering space based on the position and positionPivot
 	float renderQuadX = pos.x - m_positionPivot.x * rawSize.x;
 	float renderQuadY = pos.y - (1 - m_positionPivot.y) * rawSize.y;
@@ -177,25 +285,56 @@ void Renderer::renderMain(SDL_Rect* clip, SDL_RendererFlip flip) const
 		rot = FLT_EPSILON;
 	}
 
+	m_renderersManager->notifyTextureUse(m_texture);
 	SDL_RenderCopyEx(m_renderer, m_texture, clip, &renderQuad, rot, &center, flip);
 }
 
 
+void Renderer::storeComposedState()
+{
+	m_hasChanged = false;
+	m_wasComposedActive = isActive();
+	if (m_wasComposedActive && gameObject()->transform)
+	{
+		getRenderTransform(m_composedPosition, m_composedRotation, m_composedScale);
+	}
+}
+
+
+void Renderer::storeTickState()
+{
+	const Reference<Transform>& transform = gameObject()->transform;
+	if (transform)
+	{
+		m_tickPosition = transform->getWorldPosition();
+		m_tickRotation = transform->getWorldRotation();
+		m_tickScale = transform->getWorldScale();
+		m_hasTickState = true;
+	}
+}
+
+
 void Renderer::free()
 {
 	// Free texture if it exists
 	if (m_texture != nullptr)
 	{
-		if (m_isTextureUnique)
+		if (m_isInAtlas)
+		{
+			// Atlas pages are owned by the atlas
+			m_isInAtlas = false;
+		}
+		else if (m_isTextureUnique)
 		{
 			SDL_DestroyTexture(m_texture);
 		}
 		else
 		{
-			m_texturesManager->returnResource(m_texture);
+			m_resources->release(m_texture);
 		}
 		m_texture = nullptr;
 		m_width = 0;
 		m_height = 0;
+		markAsChanged();
 	}
 }
@@ -3,21 +3,26 @@
 
 #include "SDL2/include/SDL_render.h"
 #include <string>
+#include <list>
 #include "Component.h"
 #include "Vector2.h"
-template<typename T>
-class ResourcesManager;
+class ResourceCache;
+class RenderersManager;
+class TextureAtlas;
 
 
 class Renderer :
 	public Component
 {
 	friend class RenderersManager;
+	friend class RenderLayerCache;
 public:
 	Renderer();
 	virtual ~Renderer() = 0;
 
 	virtual void render() = 0;
+	// Advances time-based state (e.g. animation playback) once per frame, whether the renderer is drawn or not
+	virtual void advanceAnimation();
 
 	// Get dimensions
 	int getWidth() const;
@@ -40,9 +45,24 @@ public:
 	int getZIndex() const;
 	void setZIndex(int zIndex);
 
+	// Draws the renderer right where its transform is until the next tick, instead of interpolating
+	// from its previous position (to be called after teleporting it, so the jump is not drawn as a movement)
+	void snapToTransform();
+
 protected:
+	// Layer caching: whether the output differs from the one last composed into the layer cache
+	virtual bool hasChangedSinceComposed() const;
+	// Layer caching: flags a change not visible from the transform or the active state (text, clip, colour...)
+	void markAsChanged();
+
+	// World transform to draw with: the transform's, interpolated from the one it had at the start of the last tick
+	// (by Time's interpolation factor), so movement stays smooth when frames and ticks do not line up
+	void getRenderTransform(Vector2& worldPosition, float& worldRotation, Vector2& worldScale) const;
+
 	// Renders texture at given point
 	void renderMain(SDL_Rect* clip = nullptr, SDL_RendererFlip flip = SDL_FLIP_NONE) const;
+	// Renders texture with an explicit world position, rotation and scale (instead of the ones in the transform)
+	void renderMain(const Vector2& worldPosition, float worldRotation, const Vector2& worldScale, SDL_Rect* clip = nullptr, SDL_RendererFlip flip = SDL_FLIP_NONE) const;
 
 	void free();
 
@@ -53,7 +73,13 @@ protected:
 
 	// The actual hardware texture
 	SDL_Texture* m_texture = nullptr;
-	ResourcesManager<SDL_Texture>* m_texturesManager = nullptr;
+	// Shared textures are owned by the cache
+	ResourceCache* m_resources = nullptr;
+
+	// Texture atlas (if m_isInAtlas, m_texture is an atlas page and the image lies in m_atlasRegion)
+	TextureAtlas* m_textureAtlas = nullptr;
+	bool m_isInAtlas = false;
+	SDL_Rect m_atlasRegion;
 
 	// Image dimensions
 	int m_width = 0;
@@ -68,6 +94,26 @@ private:
 	// Draw-depth information
 	std::string m_renderLayer;
 	int m_zIndex;
+
+	// Position in the RenderersManager's lists of its layer (the active one or the inactive one)
+	std::list<Reference<Renderer>>::iterator m_layerListPosition;
+	bool m_isInActiveList = false;
+
+	// Interpolation (world transform at the start of the last tick, stored by the RenderersManager)
+	// A renderer that has just been activated has none, and is drawn where its transform is
+	void storeTickState();
+	bool m_hasTickState = false;
+	Vector2 m_tickPosition;
+	float m_tickRotation = 0;
+	Vector2 m_tickScale;
+
+	// Layer caching (state of the renderer when it was last composed into its layer cache)
+	void storeComposedState();
+	bool m_hasChanged = true;
+	bool m_wasComposedActive = false;
+	Vector2 m_composedPosition;
+	float m_composedRotation = 0;
+	Vector2 m_composedScale;
 };
 
 
@@ -4,6 +4,7 @@
 #include "SDL2_image/include/SDL_image.h"
 #include "gameConfig.h"
 #include "globals.h"
+#include "Engine.h"
 #include "EngineUtils.h"
 #include "ComponentType.h"
 #include "Reference.h"
@@ -11,7 +12,12 @@
 #include "SpriteRenderer.h"
 #include "GameObject.h"
 #include "Component.h"
-#include "ResourcesManager.h"
+#include "FrameCaptureFormat.h"
+#include "RenderLayerCache.h"
+#include "TextureAtlas.h"
+#include "AssetPack.h"
+#include "SceneAssets.h"
+#include "FrameProfiler.h"
 
 
 RenderersManager::RenderersManager()
@@ -21,25 +27,36 @@ RenderersManager::RenderersManager()
 
 RenderersManager::~RenderersManager()
 {
+	// Renderers that outlive the manager must not notify it when destroyed
+	for (auto* renderersByLayer : { &m_renderers, &m_inactiveRenderers })
+	{
+		for (auto& mapEntry : *renderersByLayer)
+		{
+			for (Reference<Renderer>& renderer : mapEntry.second)
+			{
+				if (renderer)
+				{
+					setSubscribed(*renderer, false);
+				}
+			}
+		}
+	}
 }
 
 
 bool RenderersManager::changeRendererLayer(const Renderer* renderer, const std::string & previousLayer, const std::string & newLayer)
 {
-	if (!validateLayerName(newLayer) || !validateLayerName(previousLayer))
+	if (!validateLayerName(newLayer) || !validateLayerName(previousLayer) || !isSubscribed(*renderer))
 	{
 		return false;
 	}
 
-	Reference<Renderer> removedRenderer = removeRendererFromLayer(renderer, previousLayer);
-
-	if (!removedRenderer)
-	{
-		return false;
-	}
+	// Move the renderer's node to the matching list of the new layer (list iterators stay valid when spliced)
+	std::list<Reference<Renderer>>& previousList = getLayerList(previousLayer, renderer->m_isInActiveList);
+	std::list<Reference<Renderer>>& newList = getLayerList(newLayer, renderer->m_isInActiveList);
+	newList.splice(newList.end(), previousList, renderer->m_layerListPosition);
 
 	m_dirtyFlags[previousLayer] = true;
-	m_renderers[newLayer].push_back(removedRenderer);
 	m_dirtyFlags[newLayer] = true;
 
 	return true;
@@ -55,30 +72,118 @@ void RenderersManager::markLayerAsDirty(const std::string & layerName)
 }
 
 
-bool RenderersManager::subscribeComponent(Reference<Component>& component)
+bool RenderersManager::setLayerCached(const std::string& layerName, bool isCached)
 {
-	if (managedComponentType() == getComponentType(component))
+	if (!validateLayerName(layerName))
 	{
-		// If component is not already in the m_renderers map of lists, add it
-		bool found = false;
-		for (auto& mapEntry : m_renderers)
+		OutputLog("WARNING: The render layer '%s' does not exist and cannot be cached!", layerName.c_str());
+		return false;
+	}
+
+	auto it = m_layerCaches.find(layerName);
+	if (!isCached)
+	{
+		if (it != m_layerCaches.end())
 		{
-			for (Reference<Renderer>& renderer : mapEntry.second)
-			{
-				if (component == renderer)
-				{
-					found = true;
-					return false;
-				}
-			}
+			delete it->second;
+			m_layerCaches.erase(it);
 		}
+		return true;
+	}
+
+	if (it != m_layerCaches.end())
+	{
+		return true;
+	}
+
+	if (!SDL_RenderTargetSupported(m_renderer))
+	{
+		OutputLog("WARNING: The renderer does not support render targets, so the render layer '%s' cannot be cached!", layerName.c_str());
+		return false;
+	}
+
+	RenderLayerCache* cache = new RenderLayerCache();
+	if (!cache->init(m_renderer, SCREEN_WIDTH * SCREEN_SIZE, SCREEN_HEIGHT * SCREEN_SIZE))
+	{
+		delete cache;
+		return false;
+	}
+	m_layerCaches[layerName] = cache;
+	return true;
+}
+
+
+bool RenderersManager::isLayerCached(const std::string& layerName) const
+{
+	return m_layerCaches.count(layerName) == 1;
+}
+
+
+int RenderersManager::getLayerCacheRebuildsPerSecond() const
+{
+	return m_layerCacheRebuildsPerSecond;
+}
+
+
+void RenderersManager::notifyTextureUse(SDL_Texture* texture)
+{
+	if (texture != m_lastUsedTexture)
+	{
+		++m_textureSwitches;
+		m_lastUsedTexture = texture;
+	}
+}
+
+
+int RenderersManager::getTextureSwitchesCount() const
+{
+	return m_lastFrameTextureSwitches;
+}
+
+
+bool RenderersManager::startCapture(const std::string& directory, FrameCaptureFormat format, int buffersCount)
+{
+	return m_frameCapture.start(directory, format, buffersCount, SCREEN_WIDTH * SCREEN_SIZE, SCREEN_HEIGHT * SCREEN_SIZE);
+}
+
+
+void RenderersManager::stopCapture()
+{
+	m_frameCapture.stop();
+}
+
+
+bool RenderersManager::isCapturing() const
+{
+	return m_frameCapture.isCapturing();
+}
+
+
+int RenderersManager::getCapturedFramesCount() const
+{
+	return m_frameCapture.getCapturedFramesCount();
+}
+
+
+int RenderersManager::getDroppedFramesCount() const
+{
+	return m_frameCapture.getDroppedFramesCount();
+}
+
+
+bool RenderersManager::subscribeComponent(Reference<Component>& component)
+{
+	// If component is not already in the m_renderers map of lists, add it
+	if (managedComponentType() == getComponentType(component) && !isSubscribed(*component))
+	{
+		setSubscribed(*component, true);
 		Reference<Renderer> renderer = component.static_reference_cast<Renderer>();
-		std::string layerName = renderer->getRenderLayer();
-		if (!validateLayerName(layerName))
-		{
-			layerName = m_renderLayers[m_renderLayers.size()-1];
-		}
-		m_renderers[layerName].push_back(renderer);
+		const std::string& layerName = resolveLayerName(renderer->getRenderLayer());
+		// Inactive renderers (e.g. pooled ones) are kept apart from the start
+		renderer->m_isInActiveList = renderer->isActive();
+		std::list<Reference<Renderer>>& layerList = getLayerList(layerName, renderer->m_isInActiveList);
+		layerList.push_back(renderer);
+		renderer->m_layerListPosition = std::prev(layerList.end());
 		m_dirtyFlags[layerName] = true;
 		initializeComponent(component);
 		return true;
@@ -89,16 +194,14 @@ bool RenderersManager::subscribeComponent(Reference<Component>& component)
 
 bool RenderersManager::unsubscribeComponent(Reference<Component>& component)
 {
-	for (auto& mapEntry : m_renderers)
+	if (component && isSubscribed(*component))
 	{
-		for (auto it = mapEntry.second.begin(); it != mapEntry.second.end(); ++it)
-		{
-			if (component == (*it))
-			{
-				mapEntry.second.erase(it);
-				return true;
-			}
-		}
+		Renderer* renderer = static_cast<Renderer*>(component.get());
+		const std::string& layerName = resolveLayerName(renderer->getRenderLayer());
+		setSubscribed(*component, false);
+		getLayerList(layerName, renderer->m_isInActiveList).erase(renderer->m_layerListPosition);
+		invalidateLayerCache(layerName);
+		return true;
 	}
 	return false;
 }
@@ -111,30 +214,64 @@ ComponentType RenderersManager::managedComponentType() const
 
 
 void RenderersManager::update()
+{
+	{
+		ScopedPhaseTimer timer(engine->profiler, FramePhase::RENDERERS);
+		drawFrame();
+	}
+
+	if (!m_isHeadless)
+	{
+		// Presenting includes waiting for vsync, so it is timed on its own
+		ScopedPhaseTimer timer(engine->profiler, FramePhase::PRESENT);
+		SDL_RenderPresent(m_renderer);
+	}
+}
+
+
+void RenderersManager::drawFrame()
 {
 	// Note: refreshRenderers ensures that all Reference in m_components are valid, so they can be safely used
 	refreshRenderers();
 
+	advanceAnimations();
+	if (m_isHeadless)
+	{
+		return;
+	}
+
 	// Set Render Color to black transparent
 	SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
 
 	// Clear screen
 	SDL_RenderClear(m_renderer);
 
+	m_lastUsedTexture = nullptr;
+	m_textureSwitches = 0;
+
 	for (const std::string& layerName : m_renderLayers)
 	{
-		for (Reference<Renderer>& rendererRef : m_renderers[layerName])
-		{
-			// Actual update
-			if (rendererRef->isActive())
-			{
-				rendererRef->render();
-			}
-		}
+		renderLayer(layerName);
+	}
+
+	m_lastFrameTextureSwitches = m_textureSwitches;
+
+	if (engine->profiler->isOverlayVisible())
+	{
+		m_profilerOverlay.render(*engine->profiler);
+	}
+
+	// Refresh the layer cache rebuilds count once per second
+	Uint32 now = SDL_GetTicks();
+	if (now - m_layerCacheRebuildsTimestamp >= 1000)
+	{
+		m_layerCacheRebuildsPerSecond = m_layerCacheRebuilds;
+		m_layerCacheRebuilds = 0;
+		m_layerCacheRebuildsTimestamp = now;
 	}
 
-	// Update screen
-	SDL_RenderPresent(m_renderer);
+	// Read back the finished frame (if capturing) before it is presented
+	m_frameCapture.captureFrame(m_renderer);
 }
 
 
@@ -143,8 +280,11 @@ bool RenderersManager::init()
 	// Success flag
 	bool success = true;
 
+	m_isHeadless = engine->isHeadless();
+
 	// Create window
-	m_window = SDL_CreateWindow(GAME_NAME.c_str(), SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH * SCREEN_SIZE, SCREEN_HEIGHT * SCREEN_SIZE, SDL_WINDOW_SHOWN);
+	Uint32 windowFlags = m_isHeadless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN;
+	m_window = SDL_CreateWindow(GAME_NAME.c_str(), SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH * SCREEN_SIZE, SCREEN_HEIGHT * SCREEN_SIZE, windowFlags);
 	if (m_window == nullptr)
 	{
 		OutputLog("Error: Window could not be created! SDL Error: %s", SDL_GetError());
@@ -154,7 +294,11 @@ bool RenderersManager::init()
 	{
 		// Create Renderer for window (used for texture rendering)
 		Uint32 flags = SDL_RENDERER_ACCELERATED;
-		if (USE_VSYNC)
+		if (m_isHeadless)
+		{
+			flags = SDL_RENDERER_SOFTWARE;
+		}
+		else if (USE_VSYNC)
 		{
 			flags |= SDL_RENDERER_PRESENTVSYNC;
 		}
@@ -173,11 +317,45 @@ bool RenderersManager::init()
 			for (const std::string& layer : m_renderLayers)
 			{
 				m_renderers[layer] = std::list<Reference<Renderer>>();
+				m_inactiveRenderers[layer] = std::list<Reference<Renderer>>();
 				m_dirtyFlags[layer] = false;
 			}
+
+			// Building the pack needs the renderer (to pre-convert the images to its pixel format)
+			if (BUILD_ASSET_PACK)
+			{
+				AssetPack::build(ASSET_PACK_PATH, assetPackConfig(), m_renderer);
+			}
+
+			// Pack the images into the texture atlas (renderers loading them will share its pages)
+			SDL_RendererInfo rendererInfo;
+			int pageSize = TEXTURE_ATLAS_PAGE_SIZE;
+			if (SDL_GetRendererInfo(m_renderer, &rendererInfo) == 0 && rendererInfo.max_texture_width > 0 && rendererInfo.max_texture_height > 0)
+			{
+				pageSize = std::min(pageSize, std::min(rendererInfo.max_texture_width, rendererInfo.max_texture_height));
+			}
+			m_textureAtlas = new TextureAtlas();
+			if (!m_textureAtlas->build(m_renderer, atlasImagesConfig(), pageSize))
+			{
+				OutputLog("WARNING: The texture atlas could not be built. Images will be loaded separately.");
+			}
+
+			if (!m_isHeadless)
+			{
+				for (const std::string& layer : cachedRenderLayersConfig())
+				{
+					setLayerCached(layer, true);
+				}
+
+				if (CAPTURE_FRAMES)
+				{
+					startCapture(CAPTURE_DIRECTORY, CAPTURE_FORMAT, CAPTURE_BUFFERS_COUNT);
+				}
+
+				m_profilerOverlay.init(m_renderer, profilerFontConfig());
+			}
 		}
 	}
-	m_texturesManager = new ResourcesManager<SDL_Texture>(SDL_DestroyTexture);
 
 	return success;
 }
@@ -185,8 +363,15 @@ bool RenderersManager::init()
 
 void RenderersManager::close()
 {
-	delete m_texturesManager;
-	m_texturesManager = nullptr;
+	stopCapture();
+	m_profilerOverlay.close();
+	for (auto& mapEntry : m_layerCaches)
+	{
+		delete mapEntry.second;
+	}
+	m_layerCaches.clear();
+	delete m_textureAtlas;
+	m_textureAtlas = nullptr;
 	SDL_DestroyRenderer(m_renderer);
 	m_renderer = nullptr;
 	SDL_DestroyWindow(m_window);
@@ -202,7 +387,8 @@ bool RenderersManager::initializeComponent(Reference<Component>& component)
 		auto renderer = component.static_reference_cast<Renderer>();
 		renderer->m_renderer = m_renderer;
 		renderer->m_renderersManager = this;
-		renderer->m_texturesManager = m_texturesManager;
+		renderer->m_resources = engine->resources;
+		renderer->m_textureAtlas = m_textureAtlas;
 		return true;
 	}
 	return false;
@@ -215,14 +401,31 @@ void RenderersManager::refreshRenderers()
 	// First remove any empty References
 	for (auto& mapEntry : m_renderers)
 	{
+		size_t previousSize = mapEntry.second.size();
 		mapEntry.second.remove_if([](Reference<Renderer>& renderer) -> bool {return !renderer; });
+		if (mapEntry.second.size() != previousSize)
+		{
+			invalidateLayerCache(mapEntry.first);
+		}
 	}
+	if (m_hasDestroyedRenderers)
+	{
+		for (auto& mapEntry : m_inactiveRenderers)
+		{
+			mapEntry.second.remove_if([](Reference<Renderer>& renderer) -> bool {return !renderer; });
+		}
+		m_hasDestroyedRenderers = false;
+	}
+
+	// Then move the renderers whose active state changed to the matching list
+	refreshActiveRenderers();
 
 	// Next verify if any layerList needs sort and if so, sort
 	for (const std::string& layerName : m_renderLayers)
 	{
 		if (m_dirtyFlags[layerName] == true)
 		{
+			invalidateLayerCache(layerName);
 			m_renderers[layerName].sort([](Reference<Renderer>& renderer1, Reference<Renderer>& renderer2) -> bool { return renderer1->getZIndex() < renderer2->getZIndex(); });
 			m_dirtyFlags[layerName] = false;
 		}
@@ -243,17 +446,163 @@ bool RenderersManager::validateLayerName(const std::string& layerName) const
 }
 
 
-Reference<Renderer> RenderersManager::removeRendererFromLayer(const Renderer* renderer, const std::string & layerToRemoveFrom)
+const std::string& RenderersManager::resolveLayerName(const std::string& layerName) const
+{
+	if (validateLayerName(layerName))
+	{
+		return layerName;
+	}
+	return m_renderLayers[m_renderLayers.size() - 1];
+}
+
+
+std::list<Reference<Renderer>>& RenderersManager::getLayerList(const std::string& layerName, bool isActiveList)
+{
+	return isActiveList ? m_renderers[layerName] : m_inactiveRenderers[layerName];
+}
+
+
+void RenderersManager::refreshActiveRenderers()
+{
+	for (Reference<Component>& component : m_componentsToRefreshActive)
+	{
+		if (component && isSubscribed(*component))
+		{
+			Renderer* renderer = static_cast<Renderer*>(component.get());
+			bool isActive = renderer->isActive();
+			if (isActive != renderer->m_isInActiveList)
+			{
+				const std::string& layerName = resolveLayerName(renderer->getRenderLayer());
+				std::list<Reference<Renderer>>& previousList = getLayerList(layerName, renderer->m_isInActiveList);
+				std::list<Reference<Renderer>>& newList = getLayerList(layerName, isActive);
+				newList.splice(newList.end(), previousList, renderer->m_layerListPosition);
+				renderer->m_isInActiveList = isActive;
+				if (isActive)
+				{
+					// The layer gets sorted (and its cache invalidated) right after
+					m_dirtyFlags[layerName] = true;
+				}
+				else
+				{
+					invalidateLayerCache(layerName);
+				}
+			}
+		}
+	}
+	m_componentsToRefreshActive.clear();
+}
+
+
+void RenderersManager::onComponentDestroyed(Component* component)
+{
+	// Note: the renderer part of component has already been destroyed at this point
+	m_hasDestroyedRenderers = true;
+}
+
+
+void RenderersManager::onComponentActiveStateChanged(Component* component)
+{
+	ComponentManager::onComponentActiveStateChanged(component);
+	// A renderer coming back (e.g. a pooled object) may have been moved anywhere meanwhile, so it is not interpolated until the next tick
+	static_cast<Renderer*>(component)->m_hasTickState = false;
+}
+
+
+void RenderersManager::storeTickStates()
 {
-	std::list<Reference<Renderer>>& selectedList = m_renderers[layerToRemoveFrom];
-	for (auto& it = selectedList.begin(); it != selectedList.end(); ++it)
+	if (m_isHeadless)
 	{
-		if ((*it).get() == renderer)
+		return;
+	}
+	for (const std::string& layerName : m_renderLayers)
+	{
+		for (Reference<Renderer>& rendererRef : m_renderers[layerName])
 		{
-			Reference<Renderer> ref = (*it);
-			selectedList.erase(it);
-			return ref;
+			if (rendererRef && rendererRef->isActive())
+			{
+				rendererRef->storeTickState();
+			}
 		}
 	}
-	return Reference<Renderer>();
-}
\ No newline at end of file
+}
+
+
+void RenderersManager::invalidateLayerCache(const std::string& layerName)
+{
+	auto it = m_layerCaches.find(layerName);
+	if (it != m_layerCaches.end())
+	{
+		it->second->invalidate();
+	}
+}
+
+
+void RenderersManager::resetLayerCaches(bool shouldRecreateTextures)
+{
+	for (auto it = m_layerCaches.begin(); it != m_layerCaches.end();)
+	{
+		RenderLayerCache* cache = it->second;
+		if (shouldRecreateTextures && !cache->init(m_renderer, SCREEN_WIDTH * SCREEN_SIZE, SCREEN_HEIGHT * SCREEN_SIZE))
+		{
+			// The layer is rendered without a cache from now on
+			OutputLog("WARNING: The cache of the render layer '%s' could not be recreated after a device reset!", it->first.c_str());
+			delete cache;
+			it = m_layerCaches.erase(it);
+			continue;
+		}
+		cache->invalidate();
+		++it;
+	}
+}
+
+
+void RenderersManager::renderLayer(const std::string& layerName)
+{
+	std::list<Reference<Renderer>>& renderers = m_renderers[layerName];
+
+	auto it = m_layerCaches.find(layerName);
+	if (it != m_layerCaches.end())
+	{
+		RenderLayerCache* cache = it->second;
+		if (!cache->needsRebuild(renderers))
+		{
+			cache->render();
+			m_lastUsedTexture = nullptr;
+			++m_textureSwitches;
+			return;
+		}
+		if (cache->rebuild(renderers))
+		{
+			++m_layerCacheRebuilds;
+			cache->render();
+			m_lastUsedTexture = nullptr;
+			++m_textureSwitches;
+			return;
+		}
+		// If the cache could not be composed, the layer is rendered as usual
+	}
+
+	for (Reference<Renderer>& rendererRef : renderers)
+	{
+		// Actual update
+		if (rendererRef->isActive())
+		{
+			rendererRef->render();
+		}
+	}
+}
+
+
+void RenderersManager::advanceAnimations()
+{
+	for (const std::string& layerName : m_renderLayers)
+	{
+		for (Reference<Renderer>& rendererRef : m_renderers[layerName])
+		{
+			if (rendererRef->isActive())
+			{
+				rendererRef->advanceAnimation();
+			}
+		}
+	}
+}
@@ -7,10 +7,12 @@
 #include "SDL2/include/SDL.h"
 #include "ComponentManager.h"
 #include "Reference.h"
+#include "FrameCapture.h"
+#include "ProfilerOverlay.h"
 class Component;
 class Renderer;
-template<typename T>
-class ResourcesManager;
+class RenderLayerCache;
+class TextureAtlas;
 
 class RenderersManager final :
 	public ComponentManager
@@ -21,6 +23,22 @@ public:
 	bool changeRendererLayer(const Renderer* renderer, const std::string& previousLayer, const std::string& newLayer);
 	void markLayerAsDirty(const std::string& layerName);
 
+	// Cached layers are composed into an off-screen texture and only re-rendered when one of their renderers changes
+	bool setLayerCached(const std::string& layerName, bool isCached);
+	bool isLayerCached(const std::string& layerName) const;
+	int getLayerCacheRebuildsPerSecond() const;
+
+	// Texture switches (consecutive draws from different textures) in the last rendered frame
+	void notifyTextureUse(SDL_Texture* texture);
+	int getTextureSwitchesCount() const;
+
+	// Frame capture (frames are read back before being presented and written to disk by a worker thread)
+	bool startCapture(const std::string& directory, FrameCaptureFormat format, int buffersCount);
+	void stopCapture();
+	bool isCapturing() const;
+	int getCapturedFramesCount() const;
+	int getDroppedFramesCount() const;
+
 private:
 	RenderersManager();
 
@@ -33,18 +51,51 @@ private:
 	virtual bool init() override;
 	virtual void close() override;
 	virtual bool initializeComponent(Reference<Component>& component) override;
+	virtual void onComponentDestroyed(Component* component) override;
+	virtual void onComponentActiveStateChanged(Component* component) override;
 	
+	// Called at the start of every simulation tick, before anything moves (see Renderer::getRenderTransform)
+	void storeTickStates();
+	void drawFrame();
 	void refreshRenderers();
+	void refreshActiveRenderers();
 	bool validateLayerName(const std::string& layerName) const;
-	Reference<Renderer> removeRendererFromLayer(const Renderer* renderer, const std::string& layerToRemoveFrom);
+	// Renderers with an invalid layer are kept in the last one
+	const std::string& resolveLayerName(const std::string& layerName) const;
+	std::list<Reference<Renderer>>& getLayerList(const std::string& layerName, bool isActiveList);
+	void invalidateLayerCache(const std::string& layerName);
+	// Render target contents are lost on some renderers (i.e. Direct3D 9 on alt-tab or resize), so every cache is composed again
+	// (recreating its texture too on a device reset)
+	void resetLayerCaches(bool shouldRecreateTextures);
+	void renderLayer(const std::string& layerName);
+	void advanceAnimations();
 
 	SDL_Window* m_window = nullptr;
 	SDL_Renderer* m_renderer = nullptr;
-	ResourcesManager<SDL_Texture>* m_texturesManager = nullptr;
+	// When running headless, textures are still loaded (in a software renderer) but nothing is drawn
+	bool m_isHeadless = false;
+	TextureAtlas* m_textureAtlas = nullptr;
 	std::vector<std::string> m_renderLayers;
 
+	// Active renderers (sorted by zIndex) and inactive ones, by layer
+	// Renderers are moved from one to the other when their active state changes, so that only the active ones get visited every frame
 	std::unordered_map<std::string, std::list<Reference<Renderer>>> m_renderers;
+	std::unordered_map<std::string, std::list<Reference<Renderer>>> m_inactiveRenderers;
 	std::unordered_map<std::string, bool> m_dirtyFlags;
+	// Inactive lists are only cleaned up of destroyed renderers when there may be any
+	bool m_hasDestroyedRenderers = false;
+
+	std::unordered_map<std::string, RenderLayerCache*> m_layerCaches;
+	int m_layerCacheRebuilds = 0;
+	int m_layerCacheRebuildsPerSecond = 0;
+	Uint32 m_layerCacheRebuildsTimestamp = 0;
+
+	SDL_Texture* m_lastUsedTexture = nullptr;
+	int m_textureSwitches = 0;
+	int m_lastFrameTextureSwitches = 0;
+
+	FrameCapture m_frameCapture;
+	ProfilerOverlay m_profilerOverlay;
 };
 
 
@@ -0,0 +1,226 @@
+#include "ResourceCache.h"
+
+#include <vector>
+#include <algorithm>
+#include "globals.h"
+
+
+namespace
+{
+	const char* getTypeName(ResourceCache::ResourceType type)
+	{
+		switch (type)
+		{
+		case ResourceCache::ResourceType::TEXTURE:
+			return "texture";
+		case ResourceCache::ResourceType::FONT:
+			return "font";
+		case ResourceCache::ResourceType::SFX:
+			return "sfx";
+		case ResourceCache::ResourceType::MUSIC:
+			return "music";
+		}
+		return "";
+	}
+}
+
+
+ResourceCache::ResourceCache()
+{
+}
+
+
+ResourceCache::~ResourceCache()
+{
+	clear();
+}
+
+
+SDL_Texture* ResourceCache::acquireTexture(AssetId id, ResourceType type)
+{
+	return static_cast<SDL_Texture*>(acquire(id, type));
+}
+
+
+Mix_Chunk* ResourceCache::acquireSFX(AssetId id)
+{
+	return static_cast<Mix_Chunk*>(acquire(id, ResourceType::SFX));
+}
+
+
+Mix_Music* ResourceCache::acquireMusic(AssetId id)
+{
+	return static_cast<Mix_Music*>(acquire(id, ResourceType::MUSIC));
+}
+
+
+bool ResourceCache::addTexture(AssetId id, const std::string& path, SDL_Texture* texture, ResourceType type)
+{
+	// Size of the texture in its own pixel format (what it takes in video memory, leaving padding aside)
+	Uint32 format = 0;
+	int width = 0;
+	int height = 0;
+	SDL_QueryTexture(texture, &format, nullptr, &width, &height);
+	return add(id, type, path, texture, (size_t)width * height * SDL_BYTESPERPIXEL(format));
+}
+
+
+bool ResourceCache::addSFX(AssetId id, const std::string& path, Mix_Chunk* sfx)
+{
+	return add(id, ResourceType::SFX, path, sfx, sizeof(Mix_Chunk) + sfx->alen);
+}
+
+
+bool ResourceCache::addMusic(AssetId id, const std::string& path, Mix_Music* music)
+{
+	// Music is streamed, and SDL_mixer does not tell how much its decoder holds
+	return add(id, ResourceType::MUSIC, path, music, 0);
+}
+
+
+bool ResourceCache::release(const void* resource)
+{
+	auto keyIt = m_keys.find(resource);
+	if (keyIt == m_keys.end())
+	{
+		return false;
+	}
+	auto entryIt = m_entries.find(keyIt->second);
+	if (--entryIt->second.references == 0)
+	{
+		freeResource(entryIt->second);
+		m_entries.erase(entryIt);
+		m_keys.erase(keyIt);
+	}
+	return true;
+}
+
+
+bool ResourceCache::hasResource(const void* resource) const
+{
+	return m_keys.count(resource) == 1;
+}
+
+
+AssetId ResourceCache::getId(const void* resource) const
+{
+	auto keyIt = m_keys.find(resource);
+	if (keyIt == m_keys.end())
+	{
+		return AssetId();
+	}
+	return m_entries.at(keyIt->second).id;
+}
+
+
+void ResourceCache::releaseAll(ResourceType type)
+{
+	for (auto it = m_entries.begin(); it != m_entries.end();)
+	{
+		if (it->second.type == type)
+		{
+			freeResource(it->second);
+			m_keys.erase(it->second.resource);
+			it = m_entries.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+
+void ResourceCache::clear()
+{
+	for (auto& mapEntry : m_entries)
+	{
+		const Entry& entry = mapEntry.second;
+		OutputLog("WARNING: The %s loaded from %s was still being held by %i users after its deletion!", getTypeName(entry.type), entry.path.c_str(), entry.references);
+		freeResource(entry);
+	}
+	m_entries.clear();
+	m_keys.clear();
+}
+
+
+void ResourceCache::logReport() const
+{
+	// Biggest first
+	std::vector<const Entry*> entries;
+	entries.reserve(m_entries.size());
+	size_t totalBytes = 0;
+	for (auto& mapEntry : m_entries)
+	{
+		entries.push_back(&mapEntry.second);
+		totalBytes += mapEntry.second.bytes;
+	}
+	std::sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) { return a->bytes != b->bytes ? a->bytes > b->bytes : a->path < b->path; });
+
+	OutputLog("INFO: Resource cache: %i resources loaded, %i KB:", (int)entries.size(), (int)(totalBytes / 1024));
+	for (const Entry* entry : entries)
+	{
+		OutputLog("INFO:   %-7s  %08x  references: %3i  %8i KB  %s", getTypeName(entry->type), entry->id.getHash(), entry->references, (int)(entry->bytes / 1024), entry->path.c_str());
+	}
+}
+
+
+ResourceCache::Key ResourceCache::getKey(AssetId id, ResourceType type) const
+{
+	return ((Key)type << 32) | id.getHash();
+}
+
+
+void* ResourceCache::acquire(AssetId id, ResourceType type)
+{
+	auto it = m_entries.find(getKey(id, type));
+	if (it == m_entries.end())
+	{
+		return nullptr;
+	}
+	++it->second.references;
+	return it->second.resource;
+}
+
+
+bool ResourceCache::add(AssetId id, ResourceType type, const std::string& path, void* resource, size_t bytes)
+{
+	Key key = getKey(id, type);
+	auto it = m_entries.find(key);
+	if (it != m_entries.end())
+	{
+		if (it->second.path != path)
+		{
+			OutputLog("ERROR: The assets %s and %s have the same id (%08x)! One of them must be renamed to be shared.", it->second.path.c_str(), path.c_str(), id.getHash());
+		}
+		return false;
+	}
+	Entry entry;
+	entry.type = type;
+	entry.id = id;
+	entry.resource = resource;
+	entry.references = 1;
+	entry.bytes = bytes;
+	entry.path = path;
+	m_entries[key] = entry;
+	m_keys[resource] = key;
+	return true;
+}
+
+
+void ResourceCache::freeResource(const Entry& entry) const
+{
+	switch (entry.type)
+	{
+	case ResourceType::TEXTURE:
+	case ResourceType::FONT:
+		SDL_DestroyTexture(static_cast<SDL_Texture*>(entry.resource));
+		break;
+	case ResourceType::SFX:
+		Mix_FreeChunk(static_cast<Mix_Chunk*>(entry.resource));
+		break;
+	case ResourceType::MUSIC:
+		Mix_FreeMusic(static_cast<Mix_Music*>(entry.resource));
+		break;
+	}
+}
@@ -0,0 +1,76 @@
+#ifndef H_RESOURCE_CACHE
+#define H_RESOURCE_CACHE
+
+#include <string>
+#include <unordered_map>
+#include "SDL2/include/SDL_render.h"
+#include "SDL2_mixer/include/SDL_mixer.h"
+#include "AssetId.h"
+
+
+// Loaded textures, fonts, SFX and music, shared by everyone using the same asset
+// Resources are found by AssetId (and back from their pointer) in constant time, and counted by reference:
+// each acquire or add must be matched by a release, and the resource is freed along with its last reference
+// Note: not thread safe (resources are only loaded and released from the main thread)
+class ResourceCache final
+{
+public:
+	enum class ResourceType
+	{
+		TEXTURE,
+		FONT,
+		SFX,
+		MUSIC
+	};
+
+	ResourceCache();
+	~ResourceCache();
+
+	// Return the cached resource (adding a reference to it), or nullptr if it has not been loaded
+	SDL_Texture* acquireTexture(AssetId id, ResourceType type = ResourceType::TEXTURE);
+	Mix_Chunk* acquireSFX(AssetId id);
+	Mix_Music* acquireMusic(AssetId id);
+
+	// Cache a newly loaded resource, with a single reference (held by the caller)
+	// Returns false, keeping the resource out of the cache, if its id is already taken
+	bool addTexture(AssetId id, const std::string& path, SDL_Texture* texture, ResourceType type = ResourceType::TEXTURE);
+	bool addSFX(AssetId id, const std::string& path, Mix_Chunk* sfx);
+	bool addMusic(AssetId id, const std::string& path, Mix_Music* music);
+
+	// Removes a reference to resource (returns false if it is not in the cache)
+	bool release(const void* resource);
+	bool hasResource(const void* resource) const;
+	AssetId getId(const void* resource) const;
+
+	// Frees every resource of type, even those still referenced
+	void releaseAll(ResourceType type);
+	// Frees every resource, warning about the ones still referenced
+	void clear();
+
+	void logReport() const;
+
+private:
+	struct Entry
+	{
+		ResourceType type;
+		AssetId id;
+		void* resource;
+		int references;
+		size_t bytes;
+		std::string path;
+	};
+
+	// The same asset may be loaded as different types of resource (i.e. an image used both by sprites and fonts)
+	typedef unsigned long long Key;
+	Key getKey(AssetId id, ResourceType type) const;
+
+	void* acquire(AssetId id, ResourceType type);
+	bool add(AssetId id, ResourceType type, const std::string& path, void* resource, size_t bytes);
+	void freeResource(const Entry& entry) const;
+
+	std::unordered_map<Key, Entry> m_entries;
+	std::unordered_map<const void*, Key> m_keys;
+};
+
+
+#endif // !H_RESOURCE_CACHE
@@ -1,6 +1,7 @@
 #ifndef H_SCENE
 #define H_SCENE
 
+#include "SceneAssets.h"
 
 class Scene
 {
@@ -10,6 +11,8 @@ public:
 	virtual ~Scene() {};
 	virtual bool load() = 0;
 	virtual void unload() = 0;
+	// Files to decode in the background before load is called
+	virtual void getAssets(SceneAssets& /*assets*/) const {}
 };
 
 
@@ -0,0 +1,18 @@
+#ifndef H_SCENE_ASSETS
+#define H_SCENE_ASSETS
+
+#include <vector>
+#include <string>
+
+
+// Manifest of the files a scene uses, decoded in the background before the scene is loaded (see Scene::getAssets)
+// Note: images packed in the texture atlas are already decoded, so listing them is a waste
+struct SceneAssets
+{
+	std::vector<std::string> images;
+	std::vector<std::string> sfx;
+	std::vector<std::string> music;
+};
+
+
+#endif // !H_SCENE_ASSETS
@@ -0,0 +1,185 @@
+#include "SceneAssetsLoader.h"
+
+#include <string.h>
+#include "SDL2_image/include/SDL_image.h"
+#include "globals.h"
+#include "Engine.h"
+#include "AssetPack.h"
+
+
+SceneAssetsLoader::SceneAssetsLoader()
+	: m_isDone(true)
+	, m_decodedCount(0)
+{
+}
+
+
+SceneAssetsLoader::~SceneAssetsLoader()
+{
+	release();
+}
+
+
+void SceneAssetsLoader::start(const SceneAssets& assets)
+{
+	release();
+
+	m_assets = assets;
+	m_assetsCount = assets.images.size() + assets.sfx.size() + assets.music.size();
+	m_decodedCount = 0;
+	m_isDone = false;
+	m_worker = std::thread(&SceneAssetsLoader::decode, this);
+}
+
+
+bool SceneAssetsLoader::isDone() const
+{
+	return m_isDone;
+}
+
+
+void SceneAssetsLoader::wait()
+{
+	if (m_worker.joinable())
+	{
+		m_worker.join();
+	}
+}
+
+
+float SceneAssetsLoader::getProgress() const
+{
+	if (m_isDone || m_assetsCount == 0)
+	{
+		return 1;
+	}
+	return (float)m_decodedCount / m_assetsCount;
+}
+
+
+void SceneAssetsLoader::release()
+{
+	wait();
+
+	for (std::pair<std::string, SDL_Surface*>& surface : m_surfaces)
+	{
+		SDL_FreeSurface(surface.second);
+	}
+	m_surfaces.clear();
+	for (std::pair<std::string, Mix_Chunk*>& chunk : m_chunks)
+	{
+		Mix_FreeChunk(chunk.second);
+	}
+	m_chunks.clear();
+	// Music that was never taken
+	for (std::pair<std::string, Mix_Music*>& music : m_music)
+	{
+		if (music.second != nullptr)
+		{
+			Mix_FreeMusic(music.second);
+		}
+	}
+	m_music.clear();
+
+	m_assets = SceneAssets();
+	m_assetsCount = 0;
+}
+
+
+SDL_Surface* SceneAssetsLoader::getSurface(const std::string& path) const
+{
+	if (m_isDone)
+	{
+		for (const std::pair<std::string, SDL_Surface*>& surface : m_surfaces)
+		{
+			if (surface.first == path)
+			{
+				return surface.second;
+			}
+		}
+	}
+	return nullptr;
+}
+
+
+Mix_Chunk* SceneAssetsLoader::createChunk(const std::string& path) const
+{
+	if (m_isDone)
+	{
+		for (const std::pair<std::string, Mix_Chunk*>& chunk : m_chunks)
+		{
+			if (chunk.first == path)
+			{
+				// Copying the samples is much cheaper than decoding them again (the copy is freed by Mix_FreeChunk, as it is "allocated")
+				Mix_Chunk* copy = static_cast<Mix_Chunk*>(SDL_malloc(sizeof(Mix_Chunk)));
+				Uint8* samples = static_cast<Uint8*>(SDL_malloc(chunk.second->alen));
+				if (copy == nullptr || samples == nullptr)
+				{
+					SDL_free(copy);
+					SDL_free(samples);
+					return nullptr;
+				}
+				memcpy(samples, chunk.second->abuf, chunk.second->alen);
+				copy->allocated = 1;
+				copy->abuf = samples;
+				copy->alen = chunk.second->alen;
+				copy->volume = chunk.second->volume;
+				return copy;
+			}
+		}
+	}
+	return nullptr;
+}
+
+
+Mix_Music* SceneAssetsLoader::takeMusic(const std::string& path)
+{
+	if (m_isDone)
+	{
+		for (std::pair<std::string, Mix_Music*>& music : m_music)
+		{
+			if (music.first == path && music.second != nullptr)
+			{
+				Mix_Music* takenMusic = music.second;
+				music.second = nullptr;
+				return takenMusic;
+			}
+		}
+	}
+	return nullptr;
+}
+
+
+void SceneAssetsLoader::decode()
+{
+	// Results are only read once m_isDone is set, so they need no locking
+	// Note: OutputLog is not thread safe, so failures are left for the main thread (which loads the file again when it's missing)
+	for (const std::string& path : m_assets.images)
+	{
+		SDL_Surface* surface = engine->assetPack->loadSurface(path);
+		if (surface != nullptr)
+		{
+			m_surfaces.push_back(std::make_pair(path, surface));
+		}
+		++m_decodedCount;
+	}
+	for (const std::string& path : m_assets.sfx)
+	{
+		Mix_Chunk* chunk = engine->assetPack->loadChunk(path);
+		if (chunk != nullptr)
+		{
+			m_chunks.push_back(std::make_pair(path, chunk));
+		}
+		++m_decodedCount;
+	}
+	for (const std::string& path : m_assets.music)
+	{
+		Mix_Music* music = engine->assetPack->loadMusic(path);
+		if (music != nullptr)
+		{
+			m_music.push_back(std::make_pair(path, music));
+		}
+		++m_decodedCount;
+	}
+	m_isDone = true;
+}
@@ -0,0 +1,54 @@
+#ifndef H_SCENE_ASSETS_LOADER
+#define H_SCENE_ASSETS_LOADER
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <thread>
+#include <atomic>
+#include "SDL2/include/SDL_surface.h"
+#include "SDL2_mixer/include/SDL_mixer.h"
+#include "SceneAssets.h"
+
+
+// Decodes the assets of a SceneAssets manifest on a worker thread, and keeps them while the scene is loaded,
+// so that loading the same files from the main thread only has to upload them (or copy them, for SFX)
+// Note: apart from start, every method is meant for the main thread, and the getters return nothing until the decoding is done
+class SceneAssetsLoader final
+{
+public:
+	SceneAssetsLoader();
+	~SceneAssetsLoader();
+
+	void start(const SceneAssets& assets);
+	bool isDone() const;
+	// Blocks until the decoding is done
+	void wait();
+	// From 0 to 1 (1 when idle)
+	float getProgress() const;
+	// Frees every decoded asset (waiting for the worker first)
+	void release();
+
+	// The surface is still owned by the loader (nullptr if path wasn't decoded)
+	SDL_Surface* getSurface(const std::string& path) const;
+	// A copy of the decoded chunk, owned by the caller (nullptr if path wasn't decoded)
+	Mix_Chunk* createChunk(const std::string& path) const;
+	// The first caller takes ownership of the decoded music (nullptr if path wasn't decoded, or it has already been taken)
+	Mix_Music* takeMusic(const std::string& path);
+
+private:
+	void decode();
+
+	SceneAssets m_assets;
+	std::vector<std::pair<std::string, SDL_Surface*>> m_surfaces;
+	std::vector<std::pair<std::string, Mix_Chunk*>> m_chunks;
+	std::vector<std::pair<std::string, Mix_Music*>> m_music;
+
+	std::thread m_worker;
+	std::atomic<bool> m_isDone;
+	std::atomic<int> m_decodedCount;
+	int m_assetsCount = 0;
+};
+
+
+#endif // !H_SCENE_ASSETS_LOADER
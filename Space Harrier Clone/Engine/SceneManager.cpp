@@ -1,18 +1,28 @@
 #include "SceneManager.h"
 
+#include <utility>
 #include "Engine.h"
 #include "EngineUtils.h"
 #include "Scene.h"
 #include "GameObjectsManager.h"
+#include "PoolAllocator.h"
+#include "SceneAssetsLoader.h"
+#include "InputController.h"
 
 
 SceneManager::SceneManager()
 {
+	m_activeAssets = new SceneAssetsLoader();
+	m_pendingAssets = new SceneAssetsLoader();
 }
 
 
 SceneManager::~SceneManager()
 {
+	delete m_pendingAssets;
+	m_pendingAssets = nullptr;
+	delete m_activeAssets;
+	m_activeAssets = nullptr;
 }
 
 
@@ -33,6 +43,23 @@ void SceneManager::loadScene(unsigned int index)
 	if (index >= 0 && index < m_scenes.size())
 	{
 		m_sceneToLoad = m_scenes.at(index);
+		if (m_preloadingScene != m_sceneToLoad)
+		{
+			startPreload(m_sceneToLoad);
+		}
+	}
+	else
+	{
+		OutputLog("WARNING: There is no scene with index %u to load!", index);
+	}
+}
+
+
+void SceneManager::preloadScene(unsigned int index)
+{
+	if (index < m_scenes.size() && m_preloadingScene != m_scenes.at(index))
+	{
+		startPreload(m_scenes.at(index));
 	}
 }
 
@@ -48,6 +75,29 @@ void SceneManager::close()
 		delete scene;
 	}
 	m_scenes.clear();
+
+	m_pendingAssets->release();
+	m_activeAssets->release();
+	m_preloadingScene = nullptr;
+	m_sceneToLoad = nullptr;
+}
+
+
+bool SceneManager::isLoadingScene() const
+{
+	return m_sceneToLoad != nullptr;
+}
+
+
+float SceneManager::getLoadProgress() const
+{
+	return m_sceneToLoad != nullptr ? m_pendingAssets->getProgress() : 1;
+}
+
+
+SceneAssetsLoader* SceneManager::getSceneAssets() const
+{
+	return m_activeAssets;
 }
 
 
@@ -58,11 +108,25 @@ void SceneManager::doLoadScene()
 		return;
 	}
 
+	// The current scene keeps running until the assets of the next one are decoded
+	if (!m_pendingAssets->isDone())
+	{
+		if (!shouldWaitForLoads())
+		{
+			return;
+		}
+		m_pendingAssets->wait();
+	}
+
 	if (m_activeScene)
 	{
 		unloadScene(m_activeScene);
 		m_activeScene = nullptr;
 	}
+	// The decoded assets are kept for the whole life of the scene (its objects may load them at any time)
+	m_activeAssets->release();
+	std::swap(m_activeAssets, m_pendingAssets);
+	m_preloadingScene = nullptr;
 	// Set scene as active
 	m_activeScene = m_sceneToLoad;
 	// reset m_sceneToLoad
@@ -78,5 +142,31 @@ void SceneManager::unloadScene(Scene* sceneToUnload) const
 	{
 		sceneToUnload->unload();
 		engine->gameObjectsManager->destroyAllGameObjects();
+
+		// Every object of the scene is gone by now, so the pools' pages are released in bulk (the next scene starts with a fresh arena)
+		engine->objectPools->logReport();
+		if (!engine->objectPools->releaseAll())
+		{
+			OutputLog("WARNING: %i pooled objects outlived their scene, so the object pools can't be released!", engine->objectPools->getLiveBlocksCount());
+		}
 	}
 }
+
+
+void SceneManager::startPreload(Scene* scene)
+{
+	// Note: release waits for a preload that is still running
+	m_pendingAssets->release();
+	m_preloadingScene = scene;
+
+	SceneAssets assets;
+	scene->getAssets(assets);
+	m_pendingAssets->start(assets);
+}
+
+
+bool SceneManager::shouldWaitForLoads() const
+{
+	// Switching scenes on whichever tick the decoding finishes would break headless runs and input replays
+	return engine->isHeadless() || engine->input->isRecording() || engine->input->isReplaying();
+}
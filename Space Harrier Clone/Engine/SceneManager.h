@@ -5,6 +5,7 @@
 #include <vector>
 #include "globals.h"
 class Scene;
+class SceneAssetsLoader;
 
 
 class SceneManager final
@@ -14,9 +15,18 @@ public:
 	~SceneManager();
 
 	void refreshScenes();
+	// The scene's assets are decoded in the background first, and the scene is switched once they are ready
 	void loadScene(unsigned int index);
+	// Starts decoding the scene's assets ahead of loadScene (e.g. while fading out the current scene)
+	void preloadScene(unsigned int index);
 	void close();
 
+	bool isLoadingScene() const;
+	// From 0 to 1, for the scene being loaded (1 when no scene is being loaded)
+	float getLoadProgress() const;
+	// Assets decoded for the active scene
+	SceneAssetsLoader* getSceneAssets() const;
+
 	template<typename T>
 	bool addScene();
 	bool hasActiveScene() const;
@@ -24,10 +34,16 @@ public:
 private:
 	void doLoadScene();
 	void unloadScene(Scene* sceneToUnload) const;
+	void startPreload(Scene* scene);
+	bool shouldWaitForLoads() const;
 
 	std::vector<Scene*> m_scenes;
 	Scene* m_activeScene = nullptr;
 	Scene* m_sceneToLoad = nullptr;
+	// Scene whose assets are being decoded into m_pendingAssets
+	Scene* m_preloadingScene = nullptr;
+	SceneAssetsLoader* m_activeAssets = nullptr;
+	SceneAssetsLoader* m_pendingAssets = nullptr;
 };
 
 template<typename T>
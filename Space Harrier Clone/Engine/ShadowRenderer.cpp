@@ -0,0 +1,70 @@
+#include "ShadowRenderer.h"
+
+#include "GameObject.h"
+#include "Transform.h"
+
+
+ShadowRenderer::ShadowRenderer()
+	: m_scale(Vector2(1, 1))
+{
+	// Shadows lie on the floor, so they are anchored at their bottom-center
+	setAllPivots(Vector2(0.5f, 0));
+}
+
+
+ShadowRenderer::~ShadowRenderer()
+{
+}
+
+
+void ShadowRenderer::render()
+{
+	if (!gameObject()->transform)
+	{
+		return;
+	}
+
+	Vector2 worldPosition;
+	float worldRotation;
+	Vector2 worldScale;
+	getRenderTransform(worldPosition, worldRotation, worldScale);
+	worldScale.x *= m_scale.x;
+	worldScale.y *= m_scale.y;
+
+	// Shadows are never rotated (they always lie flat on the floor)
+	renderModulated(worldPosition, 0, worldScale, m_hasClipRect ? &m_clipRect : nullptr);
+}
+
+
+SDL_Rect ShadowRenderer::getClipRect() const
+{
+	return m_clipRect;
+}
+
+
+void ShadowRenderer::setClipRect(const SDL_Rect& rect)
+{
+	m_clipRect = rect;
+	m_hasClipRect = true;
+	markAsChanged();
+}
+
+
+void ShadowRenderer::resetClipRect()
+{
+	m_hasClipRect = false;
+	markAsChanged();
+}
+
+
+Vector2 ShadowRenderer::getScale() const
+{
+	return m_scale;
+}
+
+
+void ShadowRenderer::setScale(const Vector2& scale)
+{
+	m_scale = scale;
+	markAsChanged();
+}
@@ -0,0 +1,33 @@
+#ifndef H_SHADOW_RENDERER
+#define H_SHADOW_RENDERER
+
+#include "SpriteRenderer.h"
+
+
+// Draws a floor shadow for its own GameObject (at the transform's world position and scale) so no extra GameObject is needed for it
+class ShadowRenderer final :
+	public SpriteRenderer
+{
+public:
+	ShadowRenderer();
+	~ShadowRenderer();
+
+	// Inherited via Renderer
+	virtual void render() override;
+
+	SDL_Rect getClipRect() const;
+	void setClipRect(const SDL_Rect& rect);
+	void resetClipRect();
+
+	// Scale applied on top of the GameObject's world scale
+	Vector2 getScale() const;
+	void setScale(const Vector2& scale);
+
+private:
+	bool m_hasClipRect = false;
+	SDL_Rect m_clipRect;
+	Vector2 m_scale;
+};
+
+
+#endif // !H_SHADOW_RENDERER
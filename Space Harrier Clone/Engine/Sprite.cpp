@@ -15,11 +15,11 @@ void Sprite::render()
 {
 	if (m_hasClipRect)
 	{
-		renderMain(&m_clipRect);
+		renderModulated(&m_clipRect);
 	}
 	else
 	{
-		renderMain();
+		renderModulated();
 	}
 	
 }
@@ -35,10 +35,12 @@ void Sprite::setClipRect(const SDL_Rect& rect)
 {
 	m_clipRect = rect;
 	m_hasClipRect = true;
+	markAsChanged();
 }
 
 
 void Sprite::resetClipRect()
 {
 	m_hasClipRect = false;
+	markAsChanged();
 }
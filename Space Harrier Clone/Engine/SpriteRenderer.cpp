@@ -2,10 +2,21 @@
 
 #include "SDL2_image/include/SDL_image.h"
 #include "globals.h"
-#include "ResourcesManager.h"
+#include "GameObject.h"
+#include "Transform.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
+#include "Engine.h"
+#include "SceneManager.h"
+#include "SceneAssetsLoader.h"
+#include "AssetPack.h"
 
 
 SpriteRenderer::SpriteRenderer()
+	: m_colorMod(SDL_Color{ 255, 255, 255, 255 })
+	, m_blendMode(SDL_BLENDMODE_NONE)
+	, m_hasBlendMode(false)
+	, m_isModulated(false)
 {
 }
 
@@ -17,60 +28,133 @@ SpriteRenderer::~SpriteRenderer()
 
 bool SpriteRenderer::loadImage(const std::string& path, bool isUnique)
 {
-	return loadImage(path, false, 0, isUnique);
+	return loadImage(AssetId(path), path.c_str(), false, 0, isUnique);
 }
 
 
 bool SpriteRenderer::loadImage(const std::string& path, Uint32 colorKey, bool isUnique)
 {
-	m_usesColorKey = true;
-	m_colorKey = colorKey;
-	return loadImage(path, true, colorKey, isUnique);
+	return loadImage(AssetId(path), path.c_str(), true, colorKey, isUnique);
+}
+
+
+bool SpriteRenderer::loadImage(const AssetPath& asset, bool isUnique)
+{
+	return loadImage(asset.id(), asset.c_str(), false, 0, isUnique);
+}
+
+
+bool SpriteRenderer::loadImage(const AssetPath& asset, Uint32 colorKey, bool isUnique)
+{
+	return loadImage(asset.id(), asset.c_str(), true, colorKey, isUnique);
 }
 
 
 
 void SpriteRenderer::setColor(Uint8 r, Uint8 g, Uint8 b)
 {
-	// Modulate texture color
-	if (m_texture != nullptr) {
-		makeUnique();
-		SDL_SetTextureColorMod(m_texture, r, g, b);
-	}
+	// Store the color modulation (applied on render)
+	m_colorMod.r = r;
+	m_colorMod.g = g;
+	m_colorMod.b = b;
+	refreshModulationFlag();
+	markAsChanged();
 }
 
 
 void SpriteRenderer::setBlendMode(SDL_BlendMode blendMode)
 {
-	// Set blending function
-	if (m_texture != nullptr) {
-		makeUnique();
-		SDL_SetTextureBlendMode(m_texture, blendMode);
-	}
+	// Store the blending function (applied on render)
+	m_blendMode = blendMode;
+	m_hasBlendMode = true;
+	refreshModulationFlag();
+	markAsChanged();
 }
 
 
 void SpriteRenderer::setAlpha(Uint8 alpha)
 {
-	// Modulate texture alpha
-	if (m_texture != nullptr) {
-		makeUnique();
-		SDL_SetTextureAlphaMod(m_texture, alpha);
+	// Store the alpha modulation (applied on render)
+	m_colorMod.a = alpha;
+	refreshModulationFlag();
+	markAsChanged();
+}
+
+
+void SpriteRenderer::renderModulated(SDL_Rect* clip) const
+{
+	if (!gameObject()->transform)
+	{
+		return;
 	}
+
+	Vector2 position;
+	float rotation;
+	Vector2 scale;
+	getRenderTransform(position, rotation, scale);
+	renderModulated(position, rotation, scale, clip);
 }
 
 
-bool SpriteRenderer::loadImage(const std::string& path, bool shouldColorKey, Uint32 colorKey, bool isUnique)
+void SpriteRenderer::renderModulated(const Vector2& worldPosition, float worldRotation, const Vector2& worldScale, SDL_Rect* clip) const
+{
+	if (!m_isModulated || m_texture == nullptr)
+	{
+		renderMain(worldPosition, worldRotation, worldScale, clip);
+		return;
+	}
+
+	// Keep the texture's current state, since it may be shared by other renderers
+	SDL_Color oldColorMod;
+	SDL_BlendMode oldBlendMode;
+	SDL_GetTextureColorMod(m_texture, &oldColorMod.r, &oldColorMod.g, &oldColorMod.b);
+	SDL_GetTextureAlphaMod(m_texture, &oldColorMod.a);
+	SDL_GetTextureBlendMode(m_texture, &oldBlendMode);
+
+	// Set, draw and restore
+	SDL_SetTextureColorMod(m_texture, m_colorMod.r, m_colorMod.g, m_colorMod.b);
+	SDL_SetTextureAlphaMod(m_texture, m_colorMod.a);
+	if (m_hasBlendMode)
+	{
+		SDL_SetTextureBlendMode(m_texture, m_blendMode);
+	}
+
+	renderMain(worldPosition, worldRotation, worldScale, clip);
+
+	SDL_SetTextureColorMod(m_texture, oldColorMod.r, oldColorMod.g, oldColorMod.b);
+	SDL_SetTextureAlphaMod(m_texture, oldColorMod.a);
+	if (m_hasBlendMode)
+	{
+		SDL_SetTextureBlendMode(m_texture, oldBlendMode);
+	}
+}
+
+
+bool SpriteRenderer::loadImage(AssetId id, const char* assetPath, bool shouldColorKey, Uint32 colorKey, bool isUnique)
 {
 	// Get rid of previous texture
 	free();
 
 	m_isTextureUnique = isUnique;
 
-	if (m_isTextureUnique || !m_texturesManager->hasResource(path))
+	// Shared, non color-keyed images are taken from the texture atlas when they have been packed in it
+	if (!m_isTextureUnique && !shouldColorKey && m_textureAtlas != nullptr && m_textureAtlas->hasImage(id))
 	{
-		// Load image at specified path as surface
-		SDL_Surface* loadedSurface = IMG_Load(path.c_str());
+		m_texture = m_textureAtlas->getImage(id, m_atlasRegion);
+		m_isInAtlas = true;
+		m_width = m_atlasRegion.w;
+		m_height = m_atlasRegion.h;
+		markAsChanged();
+		return true;
+	}
+
+	SDL_Texture* sharedTexture = m_isTextureUnique ? nullptr : m_resources->acquireTexture(id);
+	if (sharedTexture == nullptr)
+	{
+		std::string path(assetPath);
+		// Load image at specified path as surface (unless the scene already decoded it)
+		SDL_Surface* preloadedSurface = engine->sceneManager->getSceneAssets()->getSurface(path);
+		SDL_Surface* loadedSurface = preloadedSurface != nullptr ? preloadedSurface : engine->assetPack->loadSurface(path);
 		if (loadedSurface == nullptr)
 		{
 			OutputLog("Error: Unable to load image at path %s! SDL_image Error: %s", path.c_str(), IMG_GetError());
@@ -99,37 +183,34 @@ bool SpriteRenderer::loadImage(const std::string& path, bool shouldColorKey, Uin
 				m_height = loadedSurface->h;
 			}
 
-			// Free the loaded surface
-			SDL_FreeSurface(loadedSurface);
+			// Free the loaded surface (a preloaded one is shared, so its color key is undone instead)
+			if (loadedSurface != preloadedSurface)
+			{
+				SDL_FreeSurface(loadedSurface);
+			}
+			else if (shouldColorKey)
+			{
+				SDL_SetColorKey(loadedSurface, SDL_FALSE, 0);
+			}
 		}
-		if (!m_isTextureUnique && m_texture != nullptr)
+		if (!m_isTextureUnique && m_texture != nullptr && !m_resources->addTexture(id, path, m_texture))
 		{
-			m_texturesManager->saveResource(path, m_texture);
+			// Its id is taken by another asset, so this renderer keeps the texture for itself
+			m_isTextureUnique = true;
 		}
 	}
 	else
 	{
-		m_texture = m_texturesManager->getResource(path);
+		m_texture = sharedTexture;
 		SDL_QueryTexture(m_texture, nullptr, nullptr, &m_width, &m_height);
 	}
+	markAsChanged();
 
 	return m_texture != nullptr;
 }
 
 
-void SpriteRenderer::makeUnique()
+void SpriteRenderer::refreshModulationFlag()
 {
-	if (m_texture && !m_isTextureUnique)
-	{
-		std::string path = m_texturesManager->getResourceName(m_texture);
-		free();
-		if (m_usesColorKey)
-		{
-			loadImage(path, m_colorKey, true);
-		}
-		else
-		{
-			loadImage(path, true);
-		}
-	}
+	m_isModulated = m_hasBlendMode || m_colorMod.r != 255 || m_colorMod.g != 255 || m_colorMod.b != 255 || m_colorMod.a != 255;
 }
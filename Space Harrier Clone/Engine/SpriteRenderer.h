@@ -2,6 +2,7 @@
 #define H_SPRITE_RENDERER
 
 #include "Renderer.h"
+#include "AssetId.h"
 
 
 class SpriteRenderer :
@@ -14,6 +15,8 @@ public:
 
 	bool loadImage(const std::string& path, bool isUnique = false);
 	bool loadImage(const std::string& path, Uint32 colorKey, bool isUnique = false);
+	bool loadImage(const AssetPath& asset, bool isUnique = false);
+	bool loadImage(const AssetPath& asset, Uint32 colorKey, bool isUnique = false);
 
 	// Set color modulation
 	void setColor(Uint8 r, Uint8 g, Uint8 b);
@@ -24,12 +27,21 @@ public:
 	// Set alpha modulation
 	void setAlpha(Uint8 a);
 
-private:
-	bool loadImage(const std::string& path, bool shouldColorKey, Uint32 colorKey, bool isUnique);
-	void makeUnique();
+protected:
+	// Renders the (possibly shared) texture applying this renderer's modulation only for the duration of the draw
+	void renderModulated(SDL_Rect* clip = nullptr) const;
+	void renderModulated(const Vector2& worldPosition, float worldRotation, const Vector2& worldScale, SDL_Rect* clip = nullptr) const;
 
-	bool m_usesColorKey;
-	Uint32 m_colorKey;
+private:
+	// The path is only used (and copied) when the image has to be loaded
+	bool loadImage(AssetId id, const char* assetPath, bool shouldColorKey, Uint32 colorKey, bool isUnique);
+	void refreshModulationFlag();
+
+	// Modulation is stored per renderer so shared textures never need to be duplicated
+	SDL_Color m_colorMod;
+	SDL_BlendMode m_blendMode;
+	bool m_hasBlendMode;
+	bool m_isModulated;
 };
 
 
@@ -25,25 +25,31 @@ void SpriteSheet::render()
 	// Only render if an clipRect (and therefore an animation) is selected
 	if (m_currentClipRect != nullptr)
 	{
-		// Check if automatic animation playback is active
-		if (m_isPlaying && m_timeLimit != 0 && !m_isPaused)
+		renderModulated(m_currentClipRect);
+	}
+	m_renderedClipRect = m_currentClipRect;
+}
+
+
+void SpriteSheet::advanceAnimation()
+{
+	// Check if automatic animation playback is active
+	if (m_currentClipRect != nullptr && m_isPlaying && m_timeLimit != 0 && !m_isPaused)
+	{
+		// Animations advance once per frame, after all of the frame's simulation ticks
+		m_elapsedTime += engine->time->frameDeltaTime();
+		if (m_elapsedTime >= m_timeLimit)
 		{
-			m_elapsedTime += engine->time->deltaTime();
-			if (m_elapsedTime >= m_timeLimit)
+			m_elapsedTime -= m_timeLimit;
+			if (m_direction > 0)
+			{
+				nextAnimationFrame();
+			}
+			else
 			{
-				m_elapsedTime -= m_timeLimit;
-				if (m_direction > 0)
-				{
-					nextAnimationFrame();
-				}
-				else
-				{
-					previousAnimationFrame();
-				}
+				previousAnimationFrame();
 			}
 		}
-
-		renderMain(m_currentClipRect);
 	}
 }
 
@@ -66,6 +72,7 @@ bool SpriteSheet::addRectForAnimation(const std::string& animationName, const Ve
 	{
 		SDL_Rect rect{(int)topLeftCorner.x, (int)topLeftCorner.y, width, height};
 		m_animations[animationName].push_back(rect);
+		markAsChanged();
 		return true;
 	}
 	return false;
@@ -77,6 +84,7 @@ bool SpriteSheet::clearAllRectsInAnimation(const std::string& animationName)
 	if (m_animations.count(animationName) == 1)
 	{
 		m_animations[animationName].clear();
+		markAsChanged();
 		return true;
 	}
 	return false;
@@ -368,6 +376,17 @@ bool SpriteSheet::resumeAnimation()
 }
 
 
+bool SpriteSheet::hasChangedSinceComposed() const
+{
+	if (Renderer::hasChangedSinceComposed())
+	{
+		return true;
+	}
+	// Note: the state of an inactive renderer does not matter (re-activating it is already a change)
+	return isActive() && m_currentClipRect != m_renderedClipRect;
+}
+
+
 void SpriteSheet::resetCachedFields()
 {
 	m_isFinished = true;
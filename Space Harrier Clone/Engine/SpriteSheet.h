@@ -16,6 +16,7 @@ public:
 
 	// Inherited via Renderer
 	virtual void render() override;
+	virtual void advanceAnimation() override;
 
 	// Adding and removing Animations and sub-sprites
 	bool addAnimation(const std::string& animationName);
@@ -49,6 +50,10 @@ public:
 	bool pauseAnimation();
 	bool resumeAnimation();
 
+protected:
+	// Frame changes (including those of animation playback) need the sprite to be composed again
+	virtual bool hasChangedSinceComposed() const override;
+
 private:
 	void resetCachedFields();
 
@@ -56,6 +61,7 @@ private:
 	std::vector<SDL_Rect>* m_currentAnimation = nullptr;
 	std::string m_currentAnimationName = "";
 	SDL_Rect* m_currentClipRect = nullptr;
+	SDL_Rect* m_renderedClipRect = nullptr;
 	int m_currentClipRectIndex;
 
 	// automatic animation playback
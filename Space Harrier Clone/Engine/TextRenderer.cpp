@@ -4,6 +4,11 @@
 #include "globals.h"
 #include "gameConfig.h"
 #include "PixelPosition.h"
+#include "Engine.h"
+#include "SceneManager.h"
+#include "SceneAssetsLoader.h"
+#include "AssetPack.h"
+#include "ResourceCache.h"
 
 
 TextRenderer::TextRenderer()
@@ -39,8 +44,28 @@ bool TextRenderer::loadFont(const Font& font)
 	}
 	freeFontTexture();
 
-	// Load image at specified path as surface
-	SDL_Surface* loadedSurface = IMG_Load(font.path.c_str());
+	// Fonts drawn from the same image share its texture
+	AssetId id = font.path.id();
+	m_fontTexture = m_resources->acquireTexture(id, ResourceCache::ResourceType::FONT);
+	if (m_fontTexture != nullptr)
+	{
+		int width = 0;
+		int height = 0;
+		SDL_QueryTexture(m_fontTexture, nullptr, nullptr, &width, &height);
+		if (!validateFont(font, width, height))
+		{
+			freeFontTexture();
+			OutputLog("ERROR: The Font provided is not valid!");
+			return false;
+		}
+		m_font = font;
+		markAsChanged();
+		return true;
+	}
+
+	// Load image at specified path as surface (unless the scene already decoded it)
+	SDL_Surface* preloadedSurface = engine->sceneManager->getSceneAssets()->getSurface(font.path);
+	SDL_Surface* loadedSurface = preloadedSurface != nullptr ? preloadedSurface : engine->assetPack->loadSurface(font.path);
 	if (loadedSurface == nullptr)
 	{
 		OutputLog("ERROR: Unable to load font image at path %s! SDL_image Error: %s", font.path.c_str(), IMG_GetError());
@@ -49,7 +74,10 @@ bool TextRenderer::loadFont(const Font& font)
 	{
 		if (!validateFont(font, loadedSurface->w, loadedSurface->h))
 		{
-			SDL_FreeSurface(loadedSurface);
+			if (loadedSurface != preloadedSurface)
+			{
+				SDL_FreeSurface(loadedSurface);
+			}
 			OutputLog("ERROR: The Font provided is not valid!");
 			return false;
 		}
@@ -60,9 +88,18 @@ bool TextRenderer::loadFont(const Font& font)
 		{
 			OutputLog("ERROR: Unable to create font texture for font image at path %s! SDL Error: %s", font.path.c_str(), SDL_GetError());
 		}
+		else
+		{
+			// If its id is taken by another asset, the texture stays out of the cache (owned by this renderer alone)
+			m_resources->addTexture(id, font.path, m_fontTexture, ResourceCache::ResourceType::FONT);
+		}
 		// Free the loaded surface
-		SDL_FreeSurface(loadedSurface);
+		if (loadedSurface != preloadedSurface)
+		{
+			SDL_FreeSurface(loadedSurface);
+		}
 	}
+	markAsChanged();
 
 	return m_fontTexture != nullptr;
 }
@@ -120,6 +157,7 @@ void TextRenderer::setText(const std::string& text)
 	{
 		m_text = text;
 		m_shouldReloadTexture = true;
+		markAsChanged();
 	}
 }
 
@@ -258,14 +296,18 @@ void TextRenderer::freeFontTexture()
 {
 	if (m_fontTexture != nullptr)
 	{
-		SDL_DestroyTexture(m_fontTexture);
+		// Unless the texture could not be shared, the cache frees it along with its last font
+		if (!m_resources->release(m_fontTexture))
+		{
+			SDL_DestroyTexture(m_fontTexture);
+		}
 		m_fontTexture = nullptr;
 	}
 }
 
 bool TextRenderer::validateFont(const Font& font, int width, int height) const
 {
-	if (font.path.length() == 0 || font.characterWidth <= 0 || font.characterHeight <= 0)
+	if (font.path.empty() || font.characterWidth <= 0 || font.characterHeight <= 0)
 	{
 		return false;
 	}
@@ -0,0 +1,188 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include "SDL2_image/include/SDL_image.h"
+#include "globals.h"
+#include "Engine.h"
+#include "AssetPack.h"
+
+// Empty pixels left between images, so that scaled sprites never sample their neighbours
+static const int ATLAS_PADDING = 1;
+
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+
+TextureAtlas::~TextureAtlas()
+{
+	clear();
+}
+
+
+bool TextureAtlas::build(SDL_Renderer* renderer, const std::vector<std::string>& imagePaths, int maxPageSize)
+{
+	clear();
+
+	// Load every image in the renderer's pixel format (images from the asset pack already are)
+	Uint32 pixelFormat = AssetPack::getNativePixelFormat(renderer);
+	std::vector<SDL_Surface*> surfaces;
+	std::vector<std::string> paths;
+	for (const std::string& path : imagePaths)
+	{
+		SDL_Surface* loadedSurface = engine->assetPack->loadSurface(path);
+		if (loadedSurface == nullptr)
+		{
+			OutputLog("WARNING: Unable to load image at path %s for the texture atlas! SDL_image Error: %s", path.c_str(), IMG_GetError());
+			continue;
+		}
+		SDL_Surface* convertedSurface = loadedSurface;
+		if (loadedSurface->format->format != pixelFormat)
+		{
+			convertedSurface = SDL_ConvertSurfaceFormat(loadedSurface, pixelFormat, 0);
+			SDL_FreeSurface(loadedSurface);
+		}
+		if (convertedSurface == nullptr)
+		{
+			OutputLog("WARNING: Unable to convert image at path %s for the texture atlas! SDL Error: %s", path.c_str(), SDL_GetError());
+			continue;
+		}
+		if (convertedSurface->w > maxPageSize || convertedSurface->h > maxPageSize)
+		{
+			OutputLog("WARNING: Image at path %s (%ix%i) does not fit in a texture atlas page of %ix%i and will be loaded on its own!", path.c_str(), convertedSurface->w, convertedSurface->h, maxPageSize, maxPageSize);
+			SDL_FreeSurface(convertedSurface);
+			continue;
+		}
+		surfaces.push_back(convertedSurface);
+		paths.push_back(path);
+	}
+
+	// Shelf packing: tallest images first, placed left to right on shelves as high as their first image
+	std::vector<int> order(surfaces.size());
+	for (unsigned int i = 0; i < order.size(); ++i)
+	{
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&surfaces](int lhs, int rhs) -> bool { return surfaces[lhs]->h > surfaces[rhs]->h; });
+
+	std::vector<int> pagesHeights;
+	int page = 0;
+	int shelfX = 0;
+	int shelfY = 0;
+	int shelfHeight = 0;
+	for (int index : order)
+	{
+		SDL_Surface* surface = surfaces[index];
+		if (shelfX + surface->w > maxPageSize)
+		{
+			// Open a new shelf
+			shelfX = 0;
+			shelfY += shelfHeight + ATLAS_PADDING;
+			shelfHeight = 0;
+		}
+		if (shelfY + surface->h > maxPageSize)
+		{
+			// Open a new page
+			++page;
+			shelfX = 0;
+			shelfY = 0;
+			shelfHeight = 0;
+		}
+		if (shelfHeight == 0)
+		{
+			shelfHeight = surface->h;
+		}
+
+		m_entries[AssetId(paths[index])] = AtlasEntry{ page, SDL_Rect{ shelfX, shelfY, surface->w, surface->h } };
+		shelfX += surface->w + ATLAS_PADDING;
+
+		if ((int)pagesHeights.size() <= page)
+		{
+			pagesHeights.push_back(0);
+		}
+		pagesHeights[page] = std::max(pagesHeights[page], shelfY + surface->h);
+	}
+
+	// Copy the images into one surface per page and upload them
+	bool success = true;
+	for (unsigned int pageIndex = 0; pageIndex < pagesHeights.size() && success; ++pageIndex)
+	{
+		SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, maxPageSize, pagesHeights[pageIndex], 32, pixelFormat);
+		if (pageSurface == nullptr)
+		{
+			OutputLog("ERROR: Unable to create the texture atlas surface! SDL Error: %s", SDL_GetError());
+			success = false;
+			break;
+		}
+		SDL_FillRect(pageSurface, nullptr, SDL_MapRGBA(pageSurface->format, 0, 0, 0, 0));
+
+		for (unsigned int i = 0; i < surfaces.size(); ++i)
+		{
+			AtlasEntry& entry = m_entries[AssetId(paths[i])];
+			if (entry.page == (int)pageIndex)
+			{
+				// Copy the pixels as they are (including their alpha)
+				SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+				SDL_BlitSurface(surfaces[i], nullptr, pageSurface, &entry.region);
+			}
+		}
+
+		SDL_Texture* pageTexture = SDL_CreateTextureFromSurface(renderer, pageSurface);
+		SDL_FreeSurface(pageSurface);
+		if (pageTexture == nullptr)
+		{
+			OutputLog("ERROR: Unable to create the texture atlas texture! SDL Error: %s", SDL_GetError());
+			success = false;
+			break;
+		}
+		SDL_SetTextureBlendMode(pageTexture, SDL_BLENDMODE_BLEND);
+		m_pages.push_back(pageTexture);
+	}
+
+	for (SDL_Surface* surface : surfaces)
+	{
+		SDL_FreeSurface(surface);
+	}
+
+	if (!success)
+	{
+		clear();
+	}
+	return success;
+}
+
+
+void TextureAtlas::clear()
+{
+	for (SDL_Texture* page : m_pages)
+	{
+		SDL_DestroyTexture(page);
+	}
+	m_pages.clear();
+	m_entries.clear();
+}
+
+
+bool TextureAtlas::hasImage(AssetId id) const
+{
+	return m_entries.count(id) == 1;
+}
+
+
+SDL_Texture* TextureAtlas::getImage(AssetId id, SDL_Rect& region) const
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end())
+	{
+		return nullptr;
+	}
+	region = it->second.region;
+	return m_pages[it->second.page];
+}
+
+
+int TextureAtlas::getPagesCount() const
+{
+	return m_pages.size();
+}
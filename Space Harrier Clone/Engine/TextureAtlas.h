@@ -0,0 +1,39 @@
+#ifndef H_TEXTURE_ATLAS
+#define H_TEXTURE_ATLAS
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include "SDL2/include/SDL_render.h"
+#include "AssetId.h"
+
+
+// Packs a set of images into as few textures (pages) as possible at startup, so that renderers
+// using different images can share a single texture and frames switch textures less often
+class TextureAtlas final
+{
+public:
+	TextureAtlas();
+	~TextureAtlas();
+
+	bool build(SDL_Renderer* renderer, const std::vector<std::string>& imagePaths, int maxPageSize);
+	void clear();
+
+	bool hasImage(AssetId id) const;
+	// Returns the page holding the image, and its region in that page (nullptr if the image is not in the atlas)
+	SDL_Texture* getImage(AssetId id, SDL_Rect& region) const;
+	int getPagesCount() const;
+
+private:
+	struct AtlasEntry
+	{
+		int page;
+		SDL_Rect region;
+	};
+
+	std::vector<SDL_Texture*> m_pages;
+	std::unordered_map<AssetId, AtlasEntry, AssetId::Hasher> m_entries;
+};
+
+
+#endif // !H_TEXTURE_ATLAS
@@ -2,10 +2,14 @@
 
 #include "Time.h"
 #include "SDL2/include/SDL_timer.h"
+#include "globals.h"
+#include "gameConfig.h"
 
 
 TimeController::TimeController()
 {
+	m_counterFrequency = SDL_GetPerformanceFrequency();
+	setTickRate(SIMULATION_TICK_RATE);
 }
 
 
@@ -16,7 +20,7 @@ TimeController::~TimeController()
 
 Uint32 TimeController::time() const
 {
-	return m_frameStartTime;
+	return m_time;
 }
 
 
@@ -26,9 +30,108 @@ Uint32 TimeController::deltaTime() const
 }
 
 
+Uint32 TimeController::frameDeltaTime() const
+{
+	return m_frameDeltaTime;
+}
+
+
+float TimeController::interpolationFactor() const
+{
+	// A virtual clock has no real time in between ticks, so the last one is shown as is
+	if (m_isVirtual)
+	{
+		return 1;
+	}
+	return (float)m_accumulator / m_counterFrequency;
+}
+
+
+void TimeController::setTickRate(int ticksPerSecond)
+{
+	if (ticksPerSecond <= 0)
+	{
+		OutputLog("WARNING: The requested tick rate (%i) is not a positive number. The tick rate will be set to 60.", ticksPerSecond);
+		ticksPerSecond = 60;
+	}
+
+	// Ticks at the new rate are counted from the current time
+	m_tickRate = ticksPerSecond;
+	m_rateStartTicksCount = m_ticksCount;
+	m_rateStartTime = m_time;
+	m_accumulator = 0;
+	// Duration of the upcoming tick
+	m_deltaTime = getTickTime(m_ticksCount + 1) - getTickTime(m_ticksCount);
+}
+
+
+int TimeController::tickRate() const
+{
+	return m_tickRate;
+}
+
+
+void TimeController::setVirtual(bool isVirtual)
+{
+	m_isVirtual = isVirtual;
+	m_accumulator = 0;
+	m_lastCounter = 0;
+}
+
+
+bool TimeController::isVirtual() const
+{
+	return m_isVirtual;
+}
+
+
 void TimeController::updateTime()
 {
-	unsigned int currentTicks = SDL_GetTicks();
-	m_deltaTime = currentTicks - m_frameStartTime;
-	m_frameStartTime = currentTicks;
+	m_frameTicks = 0;
+	m_frameDeltaTime = 0;
+
+	if (m_isVirtual)
+	{
+		m_accumulator = m_counterFrequency;
+		return;
+	}
+
+	Uint64 currentCounter = SDL_GetPerformanceCounter();
+	if (m_lastCounter != 0)
+	{
+		m_accumulator += (currentCounter - m_lastCounter) * m_tickRate;
+	}
+	m_lastCounter = currentCounter;
+
+	// Avoid spiralling when the simulation cannot keep up: the time beyond the maximum ticks per frame is dropped
+	Uint64 maxAccumulator = m_counterFrequency * SIMULATION_MAX_TICKS_PER_FRAME;
+	if (m_accumulator > maxAccumulator)
+	{
+		m_accumulator = maxAccumulator;
+	}
+}
+
+
+bool TimeController::consumeTick()
+{
+	if (m_accumulator < m_counterFrequency || m_frameTicks >= SIMULATION_MAX_TICKS_PER_FRAME)
+	{
+		return false;
+	}
+
+	m_accumulator -= m_counterFrequency;
+	++m_ticksCount;
+	Uint32 tickTime = getTickTime(m_ticksCount);
+	m_deltaTime = tickTime - m_time;
+	m_time = tickTime;
+	m_frameDeltaTime += m_deltaTime;
+	++m_frameTicks;
+	return true;
+}
+
+
+Uint32 TimeController::getTickTime(Uint64 ticksCount) const
+{
+	// Rounded down from the exact time, so the sum of the ticks' deltaTime never drifts from it
+	return m_rateStartTime + (Uint32)((ticksCount - m_rateStartTicksCount) * 1000 / m_tickRate);
 }
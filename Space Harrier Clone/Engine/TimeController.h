@@ -4,19 +4,52 @@
 #include "SDL2/include/SDL_stdinc.h"
 
 
+// Fixed-timestep clock: real time (measured with the high-resolution performance counter) is accumulated
+// every frame and consumed in simulation ticks of constant duration
+// The tick duration is kept exact (i.e. 1/60 s, not a rounded 17 ms), so the simulation runs at the requested rate
 class TimeController final
 {
 public:
 	TimeController();
 	~TimeController();
+
+	// Simulation time (advances by deltaTime on each tick)
 	Uint32 time() const;
+	// Duration of the last simulation tick, in whole milliseconds
+	// It varies by up to 1 ms between ticks (i.e. 16 or 17 ms at 60 ticks per second), so that time() stays exact
 	Uint32 deltaTime() const;
+	// Simulation time advanced since the previous frame (the duration of all the ticks in it)
+	Uint32 frameDeltaTime() const;
+	// How far the real time is between the last tick and the next one (from 0 to 1), to interpolate rendering
+	float interpolationFactor() const;
 
+	void setTickRate(int ticksPerSecond);
+	int tickRate() const;
+	// A virtual clock runs exactly one tick per frame, regardless of the real time elapsed
+	void setVirtual(bool isVirtual);
+	bool isVirtual() const;
 	void updateTime();
+	// Returns true (and advances the simulation time) while there is enough accumulated time for another tick
+	bool consumeTick();
 
 private:
-	Uint32 m_frameStartTime = 0;
+	// Simulation time (in ms) at the end of the given tick
+	Uint32 getTickTime(Uint64 ticksCount) const;
+
+	Uint64 m_counterFrequency = 0;
+	Uint64 m_lastCounter = 0;
+	// Real time is accumulated in counter units multiplied by the tick rate, so a tick costs exactly m_counterFrequency
+	Uint64 m_accumulator = 0;
+	int m_tickRate = 0;
+	bool m_isVirtual = false;
+
+	Uint64 m_ticksCount = 0;
+	Uint64 m_rateStartTicksCount = 0;
+	Uint32 m_rateStartTime = 0;
+	Uint32 m_time = 0;
 	Uint32 m_deltaTime = 0;
+	Uint32 m_frameDeltaTime = 0;
+	int m_frameTicks = 0;
 };
 
 
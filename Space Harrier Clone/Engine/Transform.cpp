@@ -5,6 +5,7 @@
 #include <assert.h>
 #include "EngineUtils.h"
 #include "ComponentType.h"
+#include "GameObject.h"
 
 
 Transform::Transform()
@@ -27,6 +28,7 @@ Vector2 Transform::getLocalPosition() const
 
 Vector2 Transform::getWorldPosition() const
 {
+	refreshWorldFields();
 	return m_worldPosition;
 }
 
@@ -35,16 +37,12 @@ void Transform::setLocalPosition(const Vector2& position)
 {
 	m_localPosition = position;
 
-	m_worldPosition = localToWorldPosition(position);
-
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
 void Transform::setWorldPosition(const Vector2& position)
 {
-	m_worldPosition = position;
-
 	if (m_parentTransform == nullptr)
 	{
 		m_localPosition = position;
@@ -60,7 +58,7 @@ void Transform::setWorldPosition(const Vector2& position)
 		m_localPosition = worldToLocalPosition(position);
 	}
 
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
@@ -72,6 +70,7 @@ float Transform::getLocalRotation() const
 
 float Transform::getWorldRotation() const
 {
+	refreshWorldFields();
 	return m_worldRotation;
 }
 
@@ -81,22 +80,17 @@ void Transform::setLocalRotation(float rotation)
 	// Set Local Rotation
 	// Clamp between 0 and 360
 	m_localRotation = rotation - 360 * (int)(rotation / 360);
-	// Set World Rotation
-	m_worldRotation = localToWorldRotation(rotation);
 
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
 void Transform::setWorldRotation(float rotation)
 {
-	// Set World Rotation
-	// Clamp between 0 and 360
-	m_worldRotation = rotation - 360 * (int)(rotation / 360);
 	// Set Local Rotation
 	m_localRotation = worldToLocalRotation(rotation);
 
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
@@ -108,6 +102,7 @@ Vector2 Transform::getLocalScale() const
 
 Vector2 Transform::getWorldScale() const
 {
+	refreshWorldFields();
 	return m_worldScale;
 }
 
@@ -116,19 +111,15 @@ void Transform::setLocalScale(const Vector2& scale)
 {
 	m_localScale = scale;
 
-	m_worldScale = localToWorldScale(scale);
-
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
 void Transform::setWorldScale(const Vector2& scale)
 {
-	m_worldScale = scale;
-
 	m_localScale = worldToLocalScale(scale);
 
-	updateChildrenWorldFields();
+	markWorldFieldsDirty();
 }
 
 
@@ -140,28 +131,8 @@ Vector2 Transform::localToWorldPosition(const Vector2 & localPosition) const
 	}
 	else
 	{
-		Vector2 worldPosition;
-		//	1. Solve the rotation
-		//		1.1 Get polar coordinates for localPosition (r and theta)
-		float r = sqrt(localPosition.x * localPosition.x + localPosition.y * localPosition.y);
-		float theta = atan2(localPosition.y, localPosition.x);
-
-		//		1.2 use the polar coordinate to recalculate the x and y coordinates
-		float parentWorldRotation = m_parentTransform->getWorldRotation();
-		worldPosition.x = r * cosf(theta + (float)M_PI / 180 * parentWorldRotation);
-		worldPosition.y = r * sinf(theta + (float)M_PI / 180 * parentWorldRotation);
-
-		//	2. Solve the scale
-		Vector2 parentWorldScale = m_parentTransform->getWorldScale();
-		worldPosition.x *= parentWorldScale.x;
-		worldPosition.y *= parentWorldScale.y;
-
-		//	3. Solve the position
-		Vector2 parentWorldPosition = m_parentTransform->getWorldPosition();
-		worldPosition.x += parentWorldPosition.x;
-		worldPosition.y += parentWorldPosition.y;
-
-		return (worldPosition);
+		// The parent's matrix rotates, then scales and finally translates the position
+		return m_parentTransform->getLocalToWorldMatrix().transformPoint(localPosition);
 	}
 }
 
@@ -174,34 +145,13 @@ Vector2 Transform::worldToLocalPosition(const Vector2 & worldPosition) const
 	}
 	else
 	{
-		Vector2 parentWorldScale = m_parentTransform->getWorldScale();
-		if (parentWorldScale.x == 0 || parentWorldScale.y == 0)
+		// The parent's inverse matrix can't be calculated if any of its world scale components is zero
+		m_parentTransform->refreshWorldFields();
+		if (!m_parentTransform->m_isWorldToLocalValid)
 		{
 			return worldPosition;
 		}
-
-		Vector2 localPosition = Vector2();
-
-		//	1. Solve position
-		Vector2 parentWorldPosition = m_parentTransform->getWorldPosition();
-		localPosition.x = worldPosition.x - parentWorldPosition.x;
-		localPosition.y = worldPosition.y - parentWorldPosition.y;
-
-		//	2. Solve scale
-		localPosition.x /= parentWorldScale.x;
-		localPosition.y /= parentWorldScale.y;
-
-		//	3. Solve rotation
-		//		3.1 Get polar coordinates for the current localPosition (r and theta)
-		float r = sqrt(localPosition.x * localPosition.x + localPosition.y * localPosition.y);
-		float theta = atan2(localPosition.y, localPosition.x);
-
-		//		3.2 use the polar coordinate to recalculate the x and y coordinates
-		float parentWorldRotation = m_parentTransform->getWorldRotation();
-		localPosition.x = r * cosf(theta - (float)M_PI / 180 * parentWorldRotation);
-		localPosition.y = r * sinf(theta - (float)M_PI / 180 * parentWorldRotation);
-
-		return localPosition;
+		return m_parentTransform->m_worldToLocalMatrix.transformPoint(worldPosition);
 	}
 }
 
@@ -276,6 +226,19 @@ Vector2 Transform::worldToLocalScale(const Vector2 & worldScale) const
 }
 
 
+const Matrix2x3& Transform::getLocalToWorldMatrix() const
+{
+	refreshWorldFields();
+	return m_localToWorldMatrix;
+}
+
+
+void Transform::transformPointsToWorld(const Vector2* localPoints, Vector2* worldPoints, int count) const
+{
+	getLocalToWorldMatrix().transformPoints(localPoints, worldPoints, count);
+}
+
+
 const Reference<Transform>& Transform::getParent() const
 {
 	return m_parentRef;
@@ -315,6 +278,9 @@ bool Transform::setParent(Reference<Transform>& parent, bool keepWorldPosition)
 		return false;
 	}
 
+	// The world fields relative to the current parent are needed to keep the world position
+	refreshWorldFields();
+
 	// Now, we remove the parent (which in turn removes this transform from the m_parent's children list)
 	if (m_parentTransform != nullptr)
 	{
@@ -327,25 +293,28 @@ bool Transform::setParent(Reference<Transform>& parent, bool keepWorldPosition)
 		// And then set the m_parent variable
 		m_parentTransform = newParentTransform;
 		m_parentRef = parent;
+		gameObject()->refreshActiveInHierarchy();
 		if (keepWorldPosition)
 		{
 			updateLocalFields();
 		}
 		else
 		{
-			updateWorldFields();
+			markWorldFieldsDirty();
 		}
 		return true;
 	}
 	else
 	{
+		// The previous parent was removed anyway
+		gameObject()->refreshActiveInHierarchy();
 		if (keepWorldPosition)
 		{
 			updateLocalFields();
 		}
 		else
 		{
-			updateWorldFields();
+			markWorldFieldsDirty();
 		}
 		return false;
 	}
@@ -355,11 +324,13 @@ bool Transform::setParent(Reference<Transform>& parent, bool keepWorldPosition)
 
 void Transform::removeParent()
 {
+	refreshWorldFields();
 	if (m_parentTransform != nullptr)
 	{
 		m_parentTransform->removeChild(this);
 		m_parentTransform = nullptr;
 		m_parentRef.reset();
+		gameObject()->refreshActiveInHierarchy();
 	}
 	updateLocalFields();
 }
@@ -407,26 +378,58 @@ bool Transform::isTransformInChildrenHierarchy(Transform* transform) const
 
 void Transform::updateLocalFields()
 {
+	// Note: the (already refreshed) world fields don't change, so they stay valid
 	m_localPosition = worldToLocalPosition(m_worldPosition);
 	m_localRotation = worldToLocalRotation(m_worldRotation);
 	m_localScale = worldToLocalScale(m_worldScale);
 }
 
 
-void Transform::updateWorldFields()
+void Transform::refreshWorldFields() const
 {
-	m_worldPosition = localToWorldPosition(m_localPosition);
-	m_worldRotation = localToWorldRotation(m_localRotation);
-	m_worldScale = localToWorldScale(m_localScale);
-	updateChildrenWorldFields();
+	if (m_isWorldDirty)
+	{
+		// The localToWorld methods refresh the parent's world fields (if needed) through its getters
+		m_worldPosition = localToWorldPosition(m_localPosition);
+		m_worldRotation = localToWorldRotation(m_localRotation);
+		m_worldScale = localToWorldScale(m_localScale);
+		m_isWorldDirty = false;
+		refreshMatrices();
+	}
 }
 
 
-void Transform::updateChildrenWorldFields() const
+void Transform::refreshMatrices() const
 {
-	for (Transform* childTransform : m_children)
+	if (m_worldRotation != m_matricesRotation)
 	{
-		childTransform->updateWorldFields();
+		float radians = (float)M_PI / 180 * m_worldRotation;
+		m_sinWorldRotation = sinf(radians);
+		m_cosWorldRotation = cosf(radians);
+		m_matricesRotation = m_worldRotation;
+	}
+
+	// Rotation first and then scale (each row of the rotation matrix gets multiplied by the matching scale component)
+	m_localToWorldMatrix.m00 = m_worldScale.x * m_cosWorldRotation;
+	m_localToWorldMatrix.m01 = -m_worldScale.x * m_sinWorldRotation;
+	m_localToWorldMatrix.m10 = m_worldScale.y * m_sinWorldRotation;
+	m_localToWorldMatrix.m11 = m_worldScale.y * m_cosWorldRotation;
+	m_localToWorldMatrix.translation = m_worldPosition;
+
+	m_isWorldToLocalValid = m_localToWorldMatrix.getInverse(m_worldToLocalMatrix);
+}
+
+
+void Transform::markWorldFieldsDirty()
+{
+	// An already dirty transform has all of its children dirty as well
+	if (!m_isWorldDirty)
+	{
+		m_isWorldDirty = true;
+		for (Transform* childTransform : m_children)
+		{
+			childTransform->markWorldFieldsDirty();
+		}
 	}
 }
 
@@ -5,12 +5,14 @@
 #include <vector>
 #include "Reference.h"
 #include "Vector2.h"
+#include "Matrix2x3.h"
 
 
 class Transform final :
 	public Component
 {
 	friend class GameObjectsManager;
+	friend class GameObject;
 
 public:
 	Transform();
@@ -40,6 +42,10 @@ public:
 	float worldToLocalRotation(float worldRotation) const;
 	Vector2 localToWorldScale(const Vector2& localScale) const;
 	Vector2 worldToLocalScale(const Vector2& worldScale) const;
+	// Matrix mapping points expressed relative to this transform (e.g. its children's local positions) to world space
+	const Matrix2x3& getLocalToWorldMatrix() const;
+	// Batched getLocalToWorldMatrix().transformPoint (e.g. for a collider's corners)
+	void transformPointsToWorld(const Vector2* localPoints, Vector2* worldPoints, int count) const;
 
 	// Hierarchy related
 	const Reference<Transform>& getParent() const;
@@ -54,8 +60,9 @@ private:
 	bool isTransformInChildrenHierarchy(Transform* transform) const;
 
 	void updateLocalFields();
-	void updateWorldFields();
-	void updateChildrenWorldFields() const;
+	void refreshWorldFields() const;
+	void refreshMatrices() const;
+	void markWorldFieldsDirty();
 
 	// Hiding inherited members from Component
 	void setActive(bool activeState);
@@ -65,9 +72,20 @@ private:
 	float m_localRotation;
 	Vector2 m_localScale;
 
-	Vector2 m_worldPosition;
-	float m_worldRotation;
-	Vector2 m_worldScale;
+	// World fields are derived from the local ones when requested (if marked dirty)
+	// Note: if a transform is dirty, so are all of its children
+	mutable Vector2 m_worldPosition;
+	mutable float m_worldRotation;
+	mutable Vector2 m_worldScale;
+	mutable bool m_isWorldDirty = false;
+
+	// Refreshed along with the world fields (sine and cosine are only recalculated if the world rotation changed)
+	mutable Matrix2x3 m_localToWorldMatrix;
+	mutable Matrix2x3 m_worldToLocalMatrix;
+	mutable bool m_isWorldToLocalValid = true;
+	mutable float m_matricesRotation = 0;
+	mutable float m_sinWorldRotation = 0;
+	mutable float m_cosWorldRotation = 1;
 
 	// Hierarchy related
 	Transform* m_parentTransform = nullptr;
@@ -0,0 +1,32 @@
+#include "TypeId.h"
+
+
+const char* TypeId::name(int typeId)
+{
+	if (typeId < 0 || typeId >= count())
+	{
+		return "Unknown";
+	}
+	return names()[typeId];
+}
+
+
+int TypeId::count()
+{
+	return names().size();
+}
+
+
+int TypeId::registerType(const char* typeName)
+{
+	names().push_back(typeName);
+	return names().size() - 1;
+}
+
+
+std::vector<const char*>& TypeId::names()
+{
+	// Function-local so that it is initialized before any type registers itself
+	static std::vector<const char*> s_names;
+	return s_names;
+}
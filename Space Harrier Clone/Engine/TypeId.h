@@ -0,0 +1,32 @@
+#ifndef H_TYPE_ID
+#define H_TYPE_ID
+
+#include <vector>
+#include <typeinfo>
+
+
+// Small sequential ids for types (assigned the first time each type is requested)
+class TypeId final
+{
+public:
+	template<typename T>
+	static int of();
+
+	static const char* name(int typeId);
+	static int count();
+
+private:
+	static int registerType(const char* typeName);
+	static std::vector<const char*>& names();
+};
+
+
+template<typename T>
+int TypeId::of()
+{
+	static const int id = registerType(typeid(T).name());
+	return id;
+}
+
+
+#endif // !H_TYPE_ID
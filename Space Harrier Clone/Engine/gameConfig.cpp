@@ -4,6 +4,9 @@
 #include "SceneManager.h"
 #include "PrefabsFactory.h"
 #include "CollisionSystemSetup.h"
+#include "FrameCaptureFormat.h"
+#include "Font.h"
+#include "SceneAssets.h"
 
 
 const std::string GAME_NAME = "Space Harrier Tribute (by Bruno Ortiz)";
@@ -11,6 +14,40 @@ const bool USE_VSYNC = true;
 const int SCREEN_SIZE = 2;
 const int SCREEN_WIDTH = 320;
 const int SCREEN_HEIGHT = 224;
+// Fixed-timestep simulation (ticks per second, and maximum ticks run in a single frame before dropping time)
+const int SIMULATION_TICK_RATE = 60;
+const int SIMULATION_MAX_TICKS_PER_FRAME = 5;
+// Headless simulation (no window, no audio and a virtual clock). A ticks limit of 0 runs until quit
+const bool RUN_HEADLESS = false;
+const int HEADLESS_TICKS_LIMIT = 0;
+// Scene loaded at startup (its index in scenesConfig). Starting from the GameScene (1) lets headless runs simulate the game itself
+const int START_SCENE_INDEX = 0;
+// Input recording and replay (the keys recorded are listed in recordedKeysConfig)
+const bool RECORD_INPUT = false;
+const bool REPLAY_INPUT = false;
+const std::string INPUT_RECORDING_PATH = "input.rec";
+// Frame profiler (frames kept for the percentiles, overlay and CSV dump hotkeys)
+const int PROFILER_FRAMES_COUNT = 600;
+const SDL_Scancode PROFILER_OVERLAY_KEY = SDL_SCANCODE_F3;
+const SDL_Scancode PROFILER_DUMP_KEY = SDL_SCANCODE_F4;
+const std::string PROFILER_CSV_PATH = "profile.csv";
+// Behaviour types listed in the per-type cost report (logged with the CSV dump)
+const int BEHAVIOUR_PROFILER_REPORT_COUNT = 10;
+// Job system worker threads (-1 uses one per additional hardware thread, 0 runs everything on the main thread),
+// and minimum behaviours per chunk when updating the parallel-safe behaviour types
+const int JOB_WORKERS_COUNT = -1;
+const int PARALLEL_UPDATE_MIN_CHUNK = 32;
+// Asset pack mapped at startup. When BUILD_ASSET_PACK is set, it is (re)built from the files in assetPackConfig instead,
+// converted for the current renderer and audio device, and used from the next run on
+const bool BUILD_ASSET_PACK = false;
+const std::string ASSET_PACK_PATH = "assets.pack";
+// Frame capture (the directory must already exist)
+const bool CAPTURE_FRAMES = false;
+const std::string CAPTURE_DIRECTORY = "capture/";
+const FrameCaptureFormat CAPTURE_FORMAT = FrameCaptureFormat::RAW;
+const int CAPTURE_BUFFERS_COUNT = 8;
+// Maximum width and height of each texture atlas page (capped by the renderer's maximum texture size)
+const int TEXTURE_ATLAS_PAGE_SIZE = 2048;
 
 
 #include "../HomeScene.h"
@@ -24,7 +61,7 @@ bool scenesConfig()
 	success &= engine->sceneManager->addScene<GameScene>();
 	if (success)
 	{
-		engine->sceneManager->loadScene(0);
+		engine->sceneManager->loadScene(engine->getStartScene());
 	}
 	return success;
 }
@@ -84,6 +121,112 @@ std::vector<std::string> renderLayersConfig()
 }
 
 
+std::vector<std::string> atlasImagesConfig()
+{
+	// Images packed into the texture atlas at startup
+	return std::vector<std::string>{
+		ASSET_IMG_UI,
+			ASSET_IMG_BOSS,
+			ASSET_IMG_ENEMIES,
+			ASSET_IMG_CHARACTER,
+			ASSET_IMG_OBSTACLES,
+			ASSET_IMG_EXPLOSION,
+			ASSET_IMG_HOME_SCREEN,
+			ASSET_IMG_FLOOR_GREEN,
+			ASSET_IMG_BACKGROUND,
+			ASSET_IMG_BG_MOUNTAINS,
+			ASSET_IMG_BG_TREES
+	};
+}
+
+
+SceneAssets assetPackConfig()
+{
+	SceneAssets assets;
+	assets.images = {
+		ASSET_IMG_UI,
+		ASSET_IMG_BOSS,
+		ASSET_IMG_ENEMIES,
+		ASSET_IMG_CHARACTER,
+		ASSET_IMG_OBSTACLES,
+		ASSET_IMG_EXPLOSION,
+		ASSET_IMG_HOME_SCREEN,
+		ASSET_IMG_FLOOR_GREEN,
+		ASSET_IMG_BACKGROUND,
+		ASSET_IMG_BG_MOUNTAINS,
+		ASSET_IMG_BG_TREES
+	};
+	assets.sfx = {
+		ASSET_SFX_BOSS_SHOT,
+		ASSET_SFX_BULLET_BOUNCE,
+		ASSET_SFX_EXPLOSION,
+		ASSET_SFX_SPAWN_SHIP,
+		ASSET_SFX_SPAWN_BALL,
+		ASSET_SFX_ENEMY_SHOT,
+		ASSET_SFX_WELCOME,
+		ASSET_SFX_COIN,
+		ASSET_SFX_PLAYER_TRIP,
+		ASSET_SFX_PLAYER_DIE,
+		ASSET_SFX_PLAYER_REVIVE,
+		ASSET_SFX_PLAYER_SHOT
+	};
+	assets.music = { ASSET_BGM_MAIN, ASSET_BGM_BOSS, ASSET_BGM_WIN, ASSET_BGM_RANKING };
+	return assets;
+}
+
+
+std::vector<SDL_Scancode> recordedKeysConfig()
+{
+	// Every key read by the game (at most 32)
+	return std::vector<SDL_Scancode>{
+		SDL_SCANCODE_LEFT,
+			SDL_SCANCODE_RIGHT,
+			SDL_SCANCODE_UP,
+			SDL_SCANCODE_DOWN,
+			SDL_SCANCODE_LCTRL,
+			SDL_SCANCODE_SPACE,
+			SDL_SCANCODE_Q
+	};
+}
+
+
+Font profilerFontConfig()
+{
+	return getFont("smallGreen");
+}
+
+
+#include "TypeId.h"
+#include "../FloorManager.h"
+#include "../EnemiesFactory.h"
+#include "../FloorObjectsFactory.h"
+#include "../BackgroundScroller.h"
+#include "../UIManager.h"
+#include "../Ranking.h"
+std::vector<int> behaviourUpdateOrderConfig()
+{
+	// Behaviours are updated grouped by type: the types listed here go first (in this order),
+	// and the rest follow in the order their first instance was created
+	return std::vector<int>{
+		TypeId::of<FloorManager>(),
+			TypeId::of<EnemiesFactory>(),
+			TypeId::of<FloorObjectsFactory>(),
+			TypeId::of<BackgroundScroller>(),
+			TypeId::of<UIManager>(),
+			TypeId::of<Ranking>()
+	};
+}
+
+
+std::vector<std::string> cachedRenderLayersConfig()
+{
+	// Layers that rarely change (they are only re-rendered when one of their renderers changes)
+	return std::vector<std::string>{
+		RENDER_LAYER_5_UI
+	};
+}
+
+
 CollisionSystemSetup collisionSystemSetup()
 {
 	CollisionSystemSetup css;
@@ -3,18 +3,50 @@
 
 #include <vector>
 #include <string>
+#include "SDL2/include/SDL_scancode.h"
 struct CollisionSystemSetup;
+struct Font;
+struct SceneAssets;
+enum class FrameCaptureFormat;
 
 extern const std::string GAME_NAME;
 extern const bool USE_VSYNC;
 extern const int SCREEN_WIDTH;
 extern const int SCREEN_HEIGHT;
 extern const int SCREEN_SIZE;
+extern const bool CAPTURE_FRAMES;
+extern const std::string CAPTURE_DIRECTORY;
+extern const FrameCaptureFormat CAPTURE_FORMAT;
+extern const int CAPTURE_BUFFERS_COUNT;
+extern const int TEXTURE_ATLAS_PAGE_SIZE;
+extern const int SIMULATION_TICK_RATE;
+extern const int SIMULATION_MAX_TICKS_PER_FRAME;
+extern const bool RUN_HEADLESS;
+extern const int HEADLESS_TICKS_LIMIT;
+extern const int START_SCENE_INDEX;
+extern const bool RECORD_INPUT;
+extern const bool REPLAY_INPUT;
+extern const std::string INPUT_RECORDING_PATH;
+extern const int PROFILER_FRAMES_COUNT;
+extern const SDL_Scancode PROFILER_OVERLAY_KEY;
+extern const SDL_Scancode PROFILER_DUMP_KEY;
+extern const std::string PROFILER_CSV_PATH;
+extern const int BEHAVIOUR_PROFILER_REPORT_COUNT;
+extern const int JOB_WORKERS_COUNT;
+extern const int PARALLEL_UPDATE_MIN_CHUNK;
+extern const bool BUILD_ASSET_PACK;
+extern const std::string ASSET_PACK_PATH;
 
 
 bool scenesConfig();
 bool prefabsConfig();
 std::vector<std::string> renderLayersConfig();
+std::vector<std::string> cachedRenderLayersConfig();
+std::vector<std::string> atlasImagesConfig();
+SceneAssets assetPackConfig();
+std::vector<SDL_Scancode> recordedKeysConfig();
+std::vector<int> behaviourUpdateOrderConfig();
+Font profilerFontConfig();
 CollisionSystemSetup collisionSystemSetup();
 
 
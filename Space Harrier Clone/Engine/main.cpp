@@ -1,6 +1,11 @@
 #include <stdio.h>
+#include <string>
+#include <stdlib.h>
 #include "Engine.h"
 #include "globals.h"
+#include "gameConfig.h"
+#include "InputController.h"
+#include "TimeController.h"
 #include "SDL2/include/SDL_main.h"
 #pragma comment( lib, "Engine/SDL2/libx86/SDL2main.lib" )
 
@@ -11,6 +16,50 @@ int main(int argc, char* args[])
 	OutputLog("INFO: Engine will be created.");
 	engine = new Engine();
 
+	// Headless runs can also be requested from the command line: --headless [ticksLimit]
+	// Input can be recorded or replayed with: --record [path] / --replay [path]
+	// The scene loaded at startup can be selected with: --scene index (e.g. --headless --scene 1 simulates the game without going through the menu)
+	bool isHeadless = RUN_HEADLESS;
+	int headlessTicksLimit = HEADLESS_TICKS_LIMIT;
+	bool shouldRecordInput = RECORD_INPUT;
+	bool shouldReplayInput = REPLAY_INPUT;
+	std::string inputRecordingPath = INPUT_RECORDING_PATH;
+	int startSceneIndex = START_SCENE_INDEX;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = args[i];
+		if (arg == "--headless")
+		{
+			isHeadless = true;
+			if (i + 1 < argc && atoi(args[i + 1]) > 0)
+			{
+				headlessTicksLimit = atoi(args[++i]);
+			}
+		}
+		else if (arg == "--record" || arg == "--replay")
+		{
+			shouldRecordInput = arg == "--record";
+			shouldReplayInput = !shouldRecordInput;
+			if (i + 1 < argc && args[i + 1][0] != '-')
+			{
+				inputRecordingPath = args[++i];
+			}
+		}
+		else if (arg == "--scene" && i + 1 < argc)
+		{
+			startSceneIndex = atoi(args[++i]);
+		}
+	}
+	if (isHeadless)
+	{
+		OutputLog("INFO: Engine will run headless.");
+		engine->setHeadless(true, headlessTicksLimit);
+	}
+	if (startSceneIndex >= 0)
+	{
+		engine->setStartScene(startSceneIndex);
+	}
+
 	OutputLog("INFO: Engine will be initialized.");
 	if (!engine->init())
 	{
@@ -18,6 +67,17 @@ int main(int argc, char* args[])
 	}
 	else
 	{	
+		if (shouldRecordInput)
+		{
+			OutputLog("INFO: Input will be recorded to %s.", inputRecordingPath.c_str());
+			engine->input->startRecording(inputRecordingPath, recordedKeysConfig(), engine->time->tickRate());
+		}
+		else if (shouldReplayInput)
+		{
+			OutputLog("INFO: Input will be replayed from %s.", inputRecordingPath.c_str());
+			engine->input->startReplay(inputRecordingPath, engine->time->tickRate());
+		}
+
 		OutputLog("INFO: Engine will begin looping.");
 		engine->loop();
 	}
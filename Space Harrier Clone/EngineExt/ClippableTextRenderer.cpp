@@ -4,6 +4,7 @@
 #include "../Engine/GameObject.h"
 #include "../Engine/Transform.h"
 #include "../Engine/Vector2.h"
+#include "../Engine/RenderersManager.h"
 
 
 void ClippableTextRenderer::render()
@@ -23,6 +24,7 @@ void ClippableTextRenderer::setRenderRange(int xLeftWorld, int xRightWorld, int
 	m_xRight = xRightWorld * SCREEN_SIZE;
 	m_yBottom = YBottomWorld * SCREEN_SIZE;
 	m_yTop = yTopWorld * SCREEN_SIZE;
+	markAsChanged();
 	customRender();
 }
 
@@ -36,9 +38,10 @@ void ClippableTextRenderer::customRender()
 	SDL_Rect currentClipRect = m_clipRect;
 
 	// Extract info from the transform
-	Vector2 pos = gameObject()->transform->getWorldPosition();
-	float rot = gameObject()->transform->getWorldRotation();
-	Vector2 sca = gameObject()->transform->getWorldScale();
+	Vector2 pos;
+	float rot;
+	Vector2 sca;
+	getRenderTransform(pos, rot, sca);
 	Vector2 positionPivot = getPositionPivot();
 	Vector2 scalePivot = getScalePivot();
 
@@ -112,6 +115,7 @@ void ClippableTextRenderer::customRender()
 		renderQuad.h -= diff;
 	}
 
+	m_renderersManager->notifyTextureUse(m_texture);
 	SDL_RenderCopy(m_renderer, m_texture, &currentClipRect, &renderQuad);
 
 }
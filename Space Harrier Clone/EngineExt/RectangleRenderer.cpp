@@ -28,4 +28,19 @@ void RectangleRenderer::render()
 	SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
 	SDL_RenderFillRect(m_renderer, &drawRect);
 	SDL_SetRenderDrawColor(m_renderer, oldColor.r, oldColor.g, oldColor.b, oldColor.a);
+
+	m_renderedRect = rect;
+	m_renderedColor = color;
+}
+
+
+bool RectangleRenderer::hasChangedSinceComposed() const
+{
+	if (Renderer::hasChangedSinceComposed())
+	{
+		return true;
+	}
+	// Note: the state of an inactive renderer does not matter (re-activating it is already a change)
+	return isActive() && (rect.x != m_renderedRect.x || rect.y != m_renderedRect.y || rect.w != m_renderedRect.w || rect.h != m_renderedRect.h
+		|| color.r != m_renderedColor.r || color.g != m_renderedColor.g || color.b != m_renderedColor.b || color.a != m_renderedColor.a);
 }
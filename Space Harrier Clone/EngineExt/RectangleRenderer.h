@@ -16,6 +16,14 @@ public:
 
 	SDL_Rect rect;
 	SDL_Color color;
+
+protected:
+	// rect and color are public fields, so changes are detected against the last rendered values
+	virtual bool hasChangedSinceComposed() const override;
+
+private:
+	SDL_Rect m_renderedRect;
+	SDL_Color m_renderedColor;
 };
 
 
@@ -93,14 +93,17 @@ void FloorObjectMover::update()
 	// Destroy gameObject if motion is finished
 	if (normalizedCurrentProgress > m_normalizedEndProgress)
 	{
-		if (m_poolHandler)
+		Jobs::defer([this]()
 		{
-			m_poolHandler->returnToPool();
-		}
-		else
-		{
-			GameObject::destroy(gameObject());
-		}
+			if (m_poolHandler)
+			{
+				m_poolHandler->returnToPool();
+			}
+			else
+			{
+				GameObject::destroy(gameObject());
+			}
+		});
 		return;
 	}
 
@@ -109,7 +112,14 @@ void FloorObjectMover::update()
 	{
 		m_collider->zIndex = zIndex;
 	}
-	m_renderer->setZIndex(zIndex);
+	// Changing the z-index marks the whole render layer as dirty (shared by all the movers)
+	if (zIndex != m_renderer->getZIndex())
+	{
+		Jobs::defer([this, zIndex]()
+		{
+			m_renderer->setZIndex(zIndex);
+		});
+	}
 
 	adjustScale(normalizedCurrentProgress);
 	adjustPosition(normalizedCurrentProgress);
@@ -21,6 +21,8 @@ public:
 	void setupExplosion(Reference<Explosion>& explosion);
 
 	virtual void update() override;
+	// Only reads the FloorManager, and defers returning to the pool and re-sorting its render layer
+	static const bool IS_PARALLEL_SAFE = true;
 	
 private:
 	void adjustScale(float normalizedCurrentProgress);
@@ -142,3 +142,25 @@ bool GameScene::load()
 void GameScene::unload()
 {
 }
+
+
+void GameScene::getAssets(SceneAssets& assets) const
+{
+	// Every font is taken from the UI image
+	assets.images = { ASSET_IMG_UI };
+	assets.sfx = {
+		ASSET_SFX_WELCOME,
+		ASSET_SFX_COIN,
+		ASSET_SFX_EXPLOSION,
+		ASSET_SFX_ENEMY_SHOT,
+		ASSET_SFX_SPAWN_SHIP,
+		ASSET_SFX_SPAWN_BALL,
+		ASSET_SFX_BULLET_BOUNCE,
+		ASSET_SFX_BOSS_SHOT,
+		ASSET_SFX_PLAYER_TRIP,
+		ASSET_SFX_PLAYER_DIE,
+		ASSET_SFX_PLAYER_REVIVE,
+		ASSET_SFX_PLAYER_SHOT
+	};
+	assets.music = { ASSET_BGM_MAIN, ASSET_BGM_BOSS, ASSET_BGM_WIN, ASSET_BGM_RANKING };
+}
@@ -37,3 +37,11 @@ bool HomeScene::load()
 void HomeScene::unload()
 {
 }
+
+
+void HomeScene::getAssets(SceneAssets& assets) const
+{
+	// Every font is taken from the UI image
+	assets.images = { ASSET_IMG_UI };
+	assets.sfx = { ASSET_SFX_COIN };
+}
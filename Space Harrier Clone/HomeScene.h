@@ -11,6 +11,7 @@ public:
 	// Inherited via Scene
 	virtual bool load() override;
 	virtual void unload() override;
+	virtual void getAssets(SceneAssets& assets) const override;
 };
 
 
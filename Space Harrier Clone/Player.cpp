@@ -36,12 +36,11 @@ void Player::onDestroy()
 }
 
 
-void Player::init(const Reference<GameObject>& characterGo, const Reference<GameObject>& shadowGo)
+void Player::init(const Reference<GameObject>& characterGo)
 {
-	m_shadowGo = shadowGo;
 	m_characterGo = characterGo;
 	m_spriteSheet = characterGo->getComponent<SpriteSheet>();
-	assert(m_characterGo && m_shadowGo && m_spriteSheet);
+	assert(m_characterGo && m_spriteSheet);
 
 	m_state = PlayerState::MOVE;
 
@@ -85,7 +84,6 @@ void Player::start()
 	gameObject()->transform->setLocalPosition(Vector2(0, 0));
 	m_currentNormalizedPosition.x = m_midX;
 	m_currentNormalizedPosition.y = m_minY;
-	m_shadowGo->transform->setLocalPosition(Vector2(m_midX * SCREEN_WIDTH, m_minY * SCREEN_HEIGHT));
 	m_characterGo->transform->setLocalPosition(Vector2(m_midX * SCREEN_WIDTH, m_minY * SCREEN_HEIGHT));
 	m_spriteSheet->setAnimationSpeed(16);
 	m_spriteSheet->playAnimation("run");
@@ -26,7 +26,7 @@ class Player :
 public:
 	virtual void onDestroy() override;
 
-	void init(const Reference<GameObject>& characterGo, const Reference<GameObject>& shadowGo);
+	void init(const Reference<GameObject>& characterGo);
 	virtual void awake() override;
 	virtual void start() override;
 	virtual void update() override;
@@ -74,7 +74,6 @@ private:
 	bool m_isDead;
 	bool m_isAnimatingDeath;
 
-	Reference<GameObject> m_shadowGo;
 	Reference<GameObject> m_characterGo;
 	Reference<SpriteSheet> m_spriteSheet;
 	TimedAnimation* m_dieAnimation = nullptr;
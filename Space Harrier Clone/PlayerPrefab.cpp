@@ -4,7 +4,7 @@
 #include "Engine/GameObject.h"
 #include "Engine/Transform.h"
 #include "Engine/SpriteSheet.h"
-#include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/RectangleCollider.h"
 #include "gameData.h"
 #include "Player.h"
@@ -156,25 +156,18 @@ void PlayerPrefab::configureGameObject(Reference<GameObject>& gameObject) const
 			}
 		}
 
-		auto shadowGo = GameObject::createNew();
-		if (shadowGo)
+		auto shadow = gameObject->addComponent<ShadowRenderer>();
+		if (shadow)
 		{
-			shadowGo->transform->setParent(gameObject->transform, false);
+			shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
+			shadow->setZIndex(1);
 
-			auto shadow = shadowGo->addComponent<Sprite>();
-			if (shadow)
-			{
-				shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
-				shadow->setZIndex(1);
-
-				shadow->loadImage(ASSET_IMG_CHARACTER);
-				shadow->setClipRect(SDL_Rect{ 300, 50, 62, 18 });
-				shadow->setAllPivots(Vector2(0.5f, 0));
-			}
+			shadow->loadImage(ASSET_IMG_CHARACTER);
+			shadow->setClipRect(SDL_Rect{ 300, 50, 62, 18 });
 		}
-		if (characterGo && shadowGo)
+		if (characterGo)
 		{
-			player->init(characterGo, shadowGo);
+			player->init(characterGo);
 		}
 	}
 }
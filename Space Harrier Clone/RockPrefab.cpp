@@ -4,6 +4,7 @@
 #include "Engine/GameObject.h"
 #include "Engine/Transform.h"
 #include "Engine/Sprite.h"
+#include "Engine/ShadowRenderer.h"
 #include "Engine/RectangleCollider.h"
 #include "gameData.h"
 #include "FloorObjectMover.h"
@@ -15,13 +16,12 @@
 
 void RockPrefab::configureGameObject(Reference<GameObject>& gameObject) const
 {
-	auto shadowSprite = gameObject->addComponent<Sprite>();
-	if (shadowSprite)
+	auto shadow = gameObject->addComponent<ShadowRenderer>();
+	if (shadow)
 	{
-		shadowSprite->loadImage(ASSET_IMG_OBSTACLES);
-		shadowSprite->setClipRect(SDL_Rect{ 170, 190, 62, 18 });
-		shadowSprite->setAllPivots(Vector2(0.5f, 0));
-		shadowSprite->setRenderLayer(RENDER_LAYER_1_SHADOWS);
+		shadow->loadImage(ASSET_IMG_OBSTACLES);
+		shadow->setClipRect(SDL_Rect{ 170, 190, 62, 18 });
+		shadow->setRenderLayer(RENDER_LAYER_1_SHADOWS);
 	}
 
 	auto fom = gameObject->addComponent<FloorObjectMover>();
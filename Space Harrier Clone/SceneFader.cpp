@@ -78,6 +78,7 @@ void SceneFader::update()
 		{
 			if (m_isFadingOut)
 			{
+				// The switch waits for the decoding to finish, and this scene (fully covered by the fader) keeps running meanwhile
 				m_isFadingOut = false;
 				Scenes::loadScene(m_targetSceneIndex);
 			}
@@ -108,5 +109,7 @@ void SceneFader::fadeOutToScene()
 		m_rectRenderer->color.a = 0;
 		m_isFadingOut = true;
 		m_fadeElapsedTime = 0;
+		// The next scene's assets get decoded while fading out
+		Scenes::preloadScene(m_targetSceneIndex);
 	}
 }
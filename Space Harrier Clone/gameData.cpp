@@ -7,36 +7,57 @@ const int POST_DIE_BLINK_FREE_CYCLE_COUNT = 15;
 const int LIVES_PER_COIN = 3;
 int player_lives = 3;
 
-// Asset files
-const std::string ASSET_BGM_MAIN = "assets/audio/bgm/Theme.ogg";
-const std::string ASSET_BGM_BOSS = "assets/audio/bgm/S1 MOOT Boss (Skyra).ogg";
-const std::string ASSET_BGM_WIN = "assets/audio/bgm/Lake Side Memory (WIN).ogg";
-const std::string ASSET_BGM_RANKING = "assets/audio/bgm/Winners Song (Name Entry).ogg";
-
-const std::string ASSET_SFX_BOSS_SHOT = "assets/audio/sfx/SFX - BossShot.wav";
-const std::string ASSET_SFX_BULLET_BOUNCE = "assets/audio/sfx/SFX - Bullet_Bounce.wav";
-const std::string ASSET_SFX_EXPLOSION = "assets/audio/sfx/SFX - Explosion.wav";
-const std::string ASSET_SFX_SPAWN_SHIP = "assets/audio/sfx/SFX - Spawn_Ship.wav";
-const std::string ASSET_SFX_SPAWN_BALL = "assets/audio/sfx/SFX - Spawn_Ball.wav";
-const std::string ASSET_SFX_ENEMY_SHOT = "assets/audio/sfx/SFX - EnemyShot.wav";
-const std::string ASSET_SFX_WELCOME = "assets/audio/sfx/SFX - Voice - Welcome to the fantasy zone.wav";
-const std::string ASSET_SFX_COIN = "assets/audio/sfx/SFX - Coin.wav";
-const std::string ASSET_SFX_PLAYER_TRIP = "assets/audio/sfx/SFX - Voice - Ouch.wav";
-const std::string ASSET_SFX_PLAYER_DIE = "assets/audio/sfx/SFX - Voice - Aaaaargh.wav";
-const std::string ASSET_SFX_PLAYER_REVIVE = "assets/audio/sfx/SFX - Voice - Get ready.wav";
-const std::string ASSET_SFX_PLAYER_SHOT = "assets/audio/sfx/SFX - PlayerShot.wav";
-
-const std::string ASSET_IMG_UI = "assets/sprites/UI.png";
-const std::string ASSET_IMG_BOSS = "assets/sprites/Boss_lvl1.png";
-const std::string ASSET_IMG_ENEMIES  = "assets/sprites/Enemies.png";
-const std::string ASSET_IMG_CHARACTER = "assets/sprites/Character.png";
-const std::string ASSET_IMG_OBSTACLES = "assets/sprites/Floor_objects.png";
-const std::string ASSET_IMG_EXPLOSION = "assets/sprites/Explosion.png";
-const std::string ASSET_IMG_HOME_SCREEN = "assets/sprites/Home_screen.png";
-const std::string ASSET_IMG_FLOOR_GREEN = "assets/sprites/FloorGreen.png";
-const std::string ASSET_IMG_BACKGROUND = "assets/sprites/Background_lvl1.png";
-const std::string ASSET_IMG_BG_MOUNTAINS = "assets/sprites/Background_lvl1_mountains.png";
-const std::string ASSET_IMG_BG_TREES= "assets/sprites/Background_lvl1_trees.png";
+// Asset files (defined in gameData.h)
+// Every asset needs its own AssetId to be shared through the resource cache
+namespace
+{
+	constexpr AssetId ASSET_IDS[] = {
+		ASSET_BGM_MAIN.id(),
+		ASSET_BGM_BOSS.id(),
+		ASSET_BGM_WIN.id(),
+		ASSET_BGM_RANKING.id(),
+		ASSET_SFX_BOSS_SHOT.id(),
+		ASSET_SFX_BULLET_BOUNCE.id(),
+		ASSET_SFX_EXPLOSION.id(),
+		ASSET_SFX_SPAWN_SHIP.id(),
+		ASSET_SFX_SPAWN_BALL.id(),
+		ASSET_SFX_ENEMY_SHOT.id(),
+		ASSET_SFX_WELCOME.id(),
+		ASSET_SFX_COIN.id(),
+		ASSET_SFX_PLAYER_TRIP.id(),
+		ASSET_SFX_PLAYER_DIE.id(),
+		ASSET_SFX_PLAYER_REVIVE.id(),
+		ASSET_SFX_PLAYER_SHOT.id(),
+		ASSET_IMG_UI.id(),
+		ASSET_IMG_BOSS.id(),
+		ASSET_IMG_ENEMIES.id(),
+		ASSET_IMG_CHARACTER.id(),
+		ASSET_IMG_OBSTACLES.id(),
+		ASSET_IMG_EXPLOSION.id(),
+		ASSET_IMG_HOME_SCREEN.id(),
+		ASSET_IMG_FLOOR_GREEN.id(),
+		ASSET_IMG_BACKGROUND.id(),
+		ASSET_IMG_BG_MOUNTAINS.id(),
+		ASSET_IMG_BG_TREES.id()
+	};
+
+	constexpr bool areAssetIdsUnique()
+	{
+		const size_t count = sizeof(ASSET_IDS) / sizeof(AssetId);
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (size_t j = i + 1; j < count; ++j)
+			{
+				if (ASSET_IDS[i] == ASSET_IDS[j])
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+static_assert(areAssetIdsUnique(), "Two asset paths have the same AssetId, one of them must be renamed");
 
 // Prefab names
 const std::string PLAYER_PREFAB = "PlayerPrefab";
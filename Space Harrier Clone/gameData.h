@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include "Engine/gameConfig.h"
+#include "Engine/AssetId.h"
 class MotionPattern;
 struct ScoreInfo;
 struct AnimationSection;
@@ -20,36 +21,36 @@ extern const int LIVES_PER_COIN;
 extern int player_lives;
 extern std::vector<ScoreInfo> scoreInfos;
 
-// Asset files
-extern const std::string ASSET_BGM_MAIN;
-extern const std::string ASSET_BGM_BOSS;
-extern const std::string ASSET_BGM_WIN;
-extern const std::string ASSET_BGM_RANKING;
+// Asset files (their AssetIds are computed at compile time)
+constexpr AssetPath ASSET_BGM_MAIN("assets/audio/bgm/Theme.ogg");
+constexpr AssetPath ASSET_BGM_BOSS("assets/audio/bgm/S1 MOOT Boss (Skyra).ogg");
+constexpr AssetPath ASSET_BGM_WIN("assets/audio/bgm/Lake Side Memory (WIN).ogg");
+constexpr AssetPath ASSET_BGM_RANKING("assets/audio/bgm/Winners Song (Name Entry).ogg");
 
-extern const std::string ASSET_SFX_BOSS_SHOT;
-extern const std::string ASSET_SFX_BULLET_BOUNCE;
-extern const std::string ASSET_SFX_EXPLOSION;
-extern const std::string ASSET_SFX_SPAWN_SHIP;
-extern const std::string ASSET_SFX_SPAWN_BALL;
-extern const std::string ASSET_SFX_ENEMY_SHOT;
-extern const std::string ASSET_SFX_WELCOME;
-extern const std::string ASSET_SFX_COIN;
-extern const std::string ASSET_SFX_PLAYER_TRIP;
-extern const std::string ASSET_SFX_PLAYER_DIE;
-extern const std::string ASSET_SFX_PLAYER_REVIVE;
-extern const std::string ASSET_SFX_PLAYER_SHOT;
+constexpr AssetPath ASSET_SFX_BOSS_SHOT("assets/audio/sfx/SFX - BossShot.wav");
+constexpr AssetPath ASSET_SFX_BULLET_BOUNCE("assets/audio/sfx/SFX - Bullet_Bounce.wav");
+constexpr AssetPath ASSET_SFX_EXPLOSION("assets/audio/sfx/SFX - Explosion.wav");
+constexpr AssetPath ASSET_SFX_SPAWN_SHIP("assets/audio/sfx/SFX - Spawn_Ship.wav");
+constexpr AssetPath ASSET_SFX_SPAWN_BALL("assets/audio/sfx/SFX - Spawn_Ball.wav");
+constexpr AssetPath ASSET_SFX_ENEMY_SHOT("assets/audio/sfx/SFX - EnemyShot.wav");
+constexpr AssetPath ASSET_SFX_WELCOME("assets/audio/sfx/SFX - Voice - Welcome to the fantasy zone.wav");
+constexpr AssetPath ASSET_SFX_COIN("assets/audio/sfx/SFX - Coin.wav");
+constexpr AssetPath ASSET_SFX_PLAYER_TRIP("assets/audio/sfx/SFX - Voice - Ouch.wav");
+constexpr AssetPath ASSET_SFX_PLAYER_DIE("assets/audio/sfx/SFX - Voice - Aaaaargh.wav");
+constexpr AssetPath ASSET_SFX_PLAYER_REVIVE("assets/audio/sfx/SFX - Voice - Get ready.wav");
+constexpr AssetPath ASSET_SFX_PLAYER_SHOT("assets/audio/sfx/SFX - PlayerShot.wav");
 
-extern const std::string ASSET_IMG_UI;
-extern const std::string ASSET_IMG_BOSS;
-extern const std::string ASSET_IMG_ENEMIES;
-extern const std::string ASSET_IMG_CHARACTER;
-extern const std::string ASSET_IMG_OBSTACLES;
-extern const std::string ASSET_IMG_EXPLOSION;
-extern const std::string ASSET_IMG_HOME_SCREEN;
-extern const std::string ASSET_IMG_FLOOR_GREEN;
-extern const std::string ASSET_IMG_BACKGROUND;
-extern const std::string ASSET_IMG_BG_MOUNTAINS;
-extern const std::string ASSET_IMG_BG_TREES;
+constexpr AssetPath ASSET_IMG_UI("assets/sprites/UI.png");
+constexpr AssetPath ASSET_IMG_BOSS("assets/sprites/Boss_lvl1.png");
+constexpr AssetPath ASSET_IMG_ENEMIES("assets/sprites/Enemies.png");
+constexpr AssetPath ASSET_IMG_CHARACTER("assets/sprites/Character.png");
+constexpr AssetPath ASSET_IMG_OBSTACLES("assets/sprites/Floor_objects.png");
+constexpr AssetPath ASSET_IMG_EXPLOSION("assets/sprites/Explosion.png");
+constexpr AssetPath ASSET_IMG_HOME_SCREEN("assets/sprites/Home_screen.png");
+constexpr AssetPath ASSET_IMG_FLOOR_GREEN("assets/sprites/FloorGreen.png");
+constexpr AssetPath ASSET_IMG_BACKGROUND("assets/sprites/Background_lvl1.png");
+constexpr AssetPath ASSET_IMG_BG_MOUNTAINS("assets/sprites/Background_lvl1_mountains.png");
+constexpr AssetPath ASSET_IMG_BG_TREES("assets/sprites/Background_lvl1_trees.png");
 
 // Prefab names
 extern const std::string PLAYER_PREFAB;